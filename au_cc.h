@@ -1,4 +1,5 @@
 #define _POSIX_C_SOURCE 200809L // make available functionalities from 2008 edition
+#define _DEFAULT_SOURCE // make available BSD/SVID extensions such as MAP_ANONYMOUS
 #include <ctype.h>
 #include <stdarg.h>
 #include <stdbool.h>
@@ -8,11 +9,169 @@
 #include <assert.h>
 #include <errno.h>
 #include <stdint.h>
+#include <stddef.h>
+#include <limits.h>
+#include <libgen.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <setjmp.h>
+#include <pthread.h>
+#include "libau_cc.h"
 
 // string.c
 
 char* format(char* fmt, ...);
 
+// content hashes (ex: of cache entries), 128-bit FNV-1a
+typedef unsigned __int128 Hash;
+#define HASH_INIT (((Hash)0x6c62272e07bb0142 << 64) | 0x62b821756295c58d)
+Hash hash_bytes(Hash h, void* p, size_t len);
+Hash hash_string(Hash h, char* s);
+char* format_hash(Hash h);
+
+typedef struct InternTable InternTable;
+InternTable* new_intern_table(void);
+void free_intern_table(InternTable* t);
+int intern_in(InternTable* t, char* s, int len);
+int intern_table_size(InternTable* t);
+char* intern_table_name(InternTable* t, int sym);
+int intern(char* s, int len);
+char* symbol_name(int sym);
+
+// fncache.c
+
+// the assembly of a function definition (see fncache.c)
+typedef struct
+{
+    Hash hash; // fingerprint of the definition
+    char* text;
+    size_t len;
+    char** refs; // static functions the body references
+    int num_refs;
+} Fragment;
+
+typedef struct FnCache FnCache;
+FnCache* load_fn_cache(char* path);
+Fragment* find_fragment(FnCache* fns, Hash hash);
+void keep_fragment(FnCache* fns, Fragment* frag);
+void save_fn_cache(FnCache* fns, char* path);
+void free_fn_cache(FnCache* fns);
+
+// compiler.c
+
+// the state of each phase, private to its file
+typedef struct Lexer Lexer;
+typedef struct Preprocessor Preprocessor;
+typedef struct Parser Parser;
+typedef struct TypeTable TypeTable;
+typedef struct CodeGen CodeGen;
+
+// a file included by a compilation, and a hash of its contents as lexed, or
+// a path searched for an included file and not found, where a file created
+// later would be included instead
+typedef struct
+{
+    char* path;
+    Hash hash;
+    bool missing;
+} Dep;
+
+// a compiler context: the options and all the state of compilations
+// the compiler works on the context current on the calling thread (cc), so
+// contexts compile independently on different threads
+struct Compiler
+{
+    int lex_threads; // 0 picks a number from the input size and the CPU count
+    char* base_dir;  // relative paths are opened from there, if set
+
+    InternTable* names; // kept from one translation unit to the next
+    Lexer* lexer;
+    Preprocessor* pp;
+    Parser* parser;
+    TypeTable* types;
+    CodeGen* gen;
+
+    // set while a compilation is in progress: error messages are written to
+    // diag, and an error unwinds to on_error
+    FILE* diag;
+    jmp_buf* on_error;
+
+    char* error;  // messages of the last compilation, if it failed
+    char* source; // '\0'-terminated copy of the source being compiled
+
+    // sidecar file of the assembly of each function, if compiling
+    // incrementally, and its fragments while a compilation is in progress
+    char* fn_cache_path;
+    FnCache* fns;
+
+    // the files included by the last compilation, if record_deps is set, on
+    // which its cached output depends (see cache.c)
+    bool record_deps;
+    Dep* deps;
+    int num_deps;
+    int dep_capacity;
+};
+
+extern _Thread_local Compiler* cc;
+
+FILE* error_output(void);
+void error_return(void);
+void add_missing_dep(char* path);
+
+// scan.c
+
+// byte scanning kernels for the lexer's hot loops
+// every kernel stops at the '\0' that terminates the input
+typedef struct
+{
+    char* name;
+    char* (*skip_blank)(char* p);                     // first byte that is not ' ', '\t', '\v', '\f' or '\r'
+    char* (*ident_end)(char* p);                      // first byte that is not [A-Za-z0-9_]
+    char* (*find_any)(char* p, char a, char b, char c); // first byte equal to a, b, c or '\0'
+} ScanKernels;
+
+extern ScanKernels scan;
+
+bool select_scan_kernels(char* name);
+void init_scan_kernels(void);
+
+// region.c
+
+// objects allocated from a region are zeroed and aligned for any type (ex:
+// the 16-byte Hash of an Obj), and are released all at once by region_reset()
+typedef struct RegionBlock RegionBlock;
+typedef struct
+{
+    RegionBlock* first; // blocks in the order they are used
+    RegionBlock* block; // the block being allocated from
+    char* cur;
+    char* end;
+    RegionBlock* large; // objects too large for a shared block
+} Region;
+
+void* region_grow(Region* r, size_t size);
+void region_reset(Region* r);
+void region_free(Region* r);
+
+// the common case is a pointer bump
+static inline void* region_alloc(Region* r, size_t size)
+{
+    size = (size + _Alignof(max_align_t) - 1) & ~(_Alignof(max_align_t) - 1);
+    if (size > (size_t)(r->end - r->cur))
+        return region_grow(r, size);
+    void* p = r->cur;
+    r->cur += size;
+    return p;
+}
+
+// stack.c
+
+bool stack_is_low(void);
+void call_with_stack(void (*fn)(void*), void* arg);
+void reset_stack(void);
+
 // tokenize.c
 typedef enum
 {
@@ -24,37 +183,132 @@ typedef enum
     TK_STR, // string literals
 } TokenKind;
 
+// integer ID of a punctuator or keyword, classified once by the lexer
+// so that the parser compares integers instead of strings
+// single-character punctuators use their own character code (ex: equal(tok, '+'))
+typedef enum
+{
+    TI_NONE = 0, // identifier, number, string literal or EOF
+
+    // multi-character punctuators
+    PU_EQ = 256, // ==
+    PU_NE,       // !=
+    PU_LE,       // <=
+    PU_GE,       // >=
+    PU_ARROW,    // ->
+
+    // keywords
+    KW_VOID,
+    KW_RETURN,
+    KW_IF,
+    KW_ELSE,
+    KW_FOR,
+    KW_WHILE,
+    KW_SHORT,
+    KW_INT,
+    KW_LONG,
+    KW_SIZEOF,
+    KW_CHAR,
+    KW_STRUCT,
+    KW_UNION,
+    KW_TYPEDEF,
+    KW_STATIC,
+    KW_INLINE,
+    TI_END,
+} TokenId;
+
 typedef struct Type Type;
 typedef struct Token Token;
 typedef struct Node Node;
 typedef struct Member Member;
 
-struct Token
+// payload of a TK_NUM | TK_STR token
+// kept in a side table since most tokens are not literals
+typedef struct
 {
-    TokenKind kind;
-    Token* next;
     int64_t val; // if TK_NUM (int64_t = exactly 64 bits)
-    char* loc;   // token location
-    int len;     // token len (ex: length of the integer (123 => 3))
-    Type* ty;    // for TK_STR
+    int len;     // if TK_STR, length of str including the terminating '\0'
     char* str;   // string literal with terminating '\0'
+} Literal;
+
+// Token.flags
+enum
+{
+    TF_BOL = 1,      // first token of a line
+    TF_SPACE = 2,    // preceded by whitespace or a comment
+    TF_NOEXPAND = 4, // names a macro that must not be expanded (see preprocess.c)
+};
 
-    int line_num; // line number
+// tokens are stored contiguously in lexing order, thus the token
+// following tok is tok + 1 and the last token is always TK_EOF
+struct Token
+{
+    uint8_t kind;  // TokenKind
+    uint8_t flags; // TF_*
+    uint16_t id;   // TokenId if TK_OPERATOR | TK_KEYWORD
+    int offset;    // token location as an offset into the source files (see SourceFile)
+    int len;      // token len (ex: length of the integer (123 => 3))
+    union
+    {
+        int literal; // index into the literal table if TK_NUM | TK_STR
+        int sym;     // interned name if TK_IDENT
+    };
 };
 
 void error(char* fmt, ...);
 void error_at(char* loc, char* fmt, ...);
 void error_tok(Token* tok, char* fmt, ...);
-bool equal(Token* tok, char* op);
-Token* skip(Token* tok, char* op);
-bool consume(Token** rest, Token* tok, char* str);
+int line_number(Token* tok);
+int file_number(Token* tok);
+int num_source_files(void);
+char* source_file_name(int file_no);
+Hash source_file_hash(int file_no);
+char* token_loc(Token* tok);
+void print_token_text(FILE* out, Token* tok);
+Literal* get_literal(Token* tok);
+char* token_id_str(int id);
+bool equal(Token* tok, int id);
+Token* skip(Token* tok, int id);
+bool consume(Token** rest, Token* tok, int id);
+Token* tokenize(char* filename, char* p);
+Token* tokenize_buffer(char* filename, char* p, size_t size);
+Token* tokenize_source(char* filename, char* p, size_t size);
 Token*
 tokenize_file(char* filename);
+Token* tokenize_more(void);
+int load_source_file(char* path);
+char* read_file(FILE* fp, size_t* size_out);
+Token* file_tokens(int file_no);
+Token* tokenize_fragment(char* text, Token* origin);
+Lexer* new_lexer(void);
+void reset_lexer(void);
+void free_lexer(Lexer* lx);
 
 #define unreachable() \
     error("internal error at %s:%d", __FILE__, __LINE__);
+
+// preprocess.c
+
+void add_include_path(char* dir);
+void clear_include_paths(void);
+Token* preprocess(Token* tok);
+Preprocessor* new_preprocessor(void);
+void reset_preprocessor(void);
+void free_preprocessor(Preprocessor* pp);
+
 // parse.c
 
+// a global initialized with the address of another global
+// the 8 bytes at offset hold the address of label plus addend
+typedef struct Relocation Relocation;
+struct Relocation
+{
+    Relocation* next;
+    int offset;
+    char* label;
+    long addend;
+};
+
 // variable or function
 typedef struct Obj Obj;
 struct Obj
@@ -67,14 +321,29 @@ struct Obj
     bool is_local;    // local or global/function
     bool is_function; // global variable or function
     bool is_definition;
+    bool is_static; // internal linkage
 
     // global variable
     char* init_data;
-
+    Relocation* rel; // in ascending order of offset
+
+    // function
+    // the body of a static function is parsed only once the function is
+    // referenced; until then body_tok is its "{" and body is NULL
+    bool is_referenced;
+    Token* body_tok;
+    int scope_mark; // bindings declared before the definition (see function_body())
     Obj* params;
     Node* body;
     Obj* locals; // local variables
     int stack_size;
+    Obj* literals; // string literals of the body, emitted with the function
+
+    // incremental compilation (see fncache.c)
+    Hash hash;          // fingerprint of the definition
+    Fragment* fragment; // assembly reused in place of the body, which is not parsed
+    Obj** refs;         // static functions the body references
+    int num_refs;
 };
 
 typedef enum
@@ -106,36 +375,62 @@ typedef enum
 } NodeKind;
 
 // abstract syntax tree
+// a node is a common header followed by a payload laid out by its kind
+// nodes are allocated with the payload of their own kind only (see
+// node_size() in parse.c), thus a field of another kind must not be touched
 struct Node
 {
     NodeKind kind;
     Node* next;
     Type* ty;   // Type: value or pointer
     Token* tok; // representative token
-    Node* lhs;
-    Node* rhs;
-    int64_t val;
-    Obj* var; // kind == ND_VAR
-
-    // block || statement expression
-    Node* body; // kind == ND_BLOCK
-
-    // struct member access
-    Member* member;
-
-    char* funcname; // function call
-    Node* args;
-
-    // if || for statement
-    Node* cond;
-    Node* then;
-    Node* els;
-    Node* init;
-    Node* inc;
+
+    union
+    {
+        // unary and binary operators, cast, expression statement, return
+        // struct member access: lhs.member
+        struct
+        {
+            Node* lhs;
+            union
+            {
+                Node* rhs;
+                Member* member;
+            };
+        };
+
+        int64_t val; // ND_NUM
+        Obj* var;    // ND_VAR
+        Node* body;  // ND_BLOCK | ND_STMT_EXPR
+
+        // function call
+        struct
+        {
+            char* funcname;
+            Node* args;
+        };
+
+        // if (cond) then else els
+        // for (init; cond; inc) then
+        struct
+        {
+            Node* cond;
+            Node* then;
+            union
+            {
+                Node* els;
+                Node* init;
+            };
+            Node* inc;
+        };
+    };
 };
 
 Node* new_cast(Node* expr, Type* ty);
 Obj* parse(Token* tok);
+Parser* new_parser(void);
+void reset_parser(void);
+void free_parser(Parser* ps);
 
 // type.c
 typedef enum
@@ -165,6 +460,8 @@ struct Type
     Type* base;
 
     // declaration
+    // set by declarator() on the type it returns, which may be shared, thus
+    // only valid until the next declarator is parsed
     Token* name;
 
     // array
@@ -172,6 +469,9 @@ struct Type
 
     // struct
     Member* members;
+    // hash table of members keyed by symbol (see struct_members())
+    Member** member_index;
+    int member_index_capacity; // power of 2
 
     // Function type
     Type* return_ty;
@@ -184,16 +484,17 @@ struct Member
 {
     Member* next;
     Type* ty;
-    Token* name;
+    char* name;
+    int sym; // interned name
     int offset;
 };
 
 
-extern Type* ty_void;
-extern Type* ty_char;
-extern Type* ty_short;
-extern Type* ty_int;
-extern Type* ty_long;
+extern _Thread_local Type ty_void[1];
+extern _Thread_local Type ty_char[1];
+extern _Thread_local Type ty_short[1];
+extern _Thread_local Type ty_int[1];
+extern _Thread_local Type ty_long[1];
 
 bool is_integer(Type* ty);
 Type* copy_type(Type* ty);
@@ -201,7 +502,29 @@ void add_type(Node* node);
 Type* pointer_to(Type* base);
 Type* func_type(Type* return_ty);
 Type* array_of(Type* base, int size);
+Type* struct_type(void);
+TypeTable* new_type_table(void);
+void reset_types(void);
+void free_type_table(TypeTable* tt);
+
+// server.c
+int run_server(char* path);
+int compile_remote(char* path, char** include_paths, int num_include_paths, int lex_threads,
+                   char* input, char** out, size_t* out_len);
+
+// cache.c
+typedef struct Cache Cache;
+
+Hash compiler_id(void);
+Cache* open_cache(char* dir, int64_t max_size);
+char* cache_key(char* input, char* src, size_t size, char** include_paths, int num_include_paths);
+char* cache_lookup(Cache* cache, char* key, size_t* len);
+void cache_store(Cache* cache, char* key, char* out, size_t len, Dep* deps, int num_deps);
+void close_cache(Cache* cache);
+void print_cache_stats(char* dir);
 
 // codegen.c
 void codegen(Obj* prog, FILE* out);
+CodeGen* new_codegen(void);
+void free_codegen(CodeGen* gen);
 int align_to(int n, int align);
\ No newline at end of file
@@ -0,0 +1,101 @@
+// lexer microbenchmark
+// lexes the given files (or a synthetic translation unit with long comment
+// blocks, string tables and identifiers when no file is given) with every
+// scanning kernel the CPU supports and reports the throughput in MB/s
+//
+// usage: bench/lex [ -n <iterations> ] [ <file>... ]
+// build the compiler objects with optimization for meaningful numbers:
+//   make clean && make CFLAGS="-std=c11 -O2 -fno-common" bench
+
+#include "../au_cc.h"
+#include <time.h>
+
+static char* synthetic_input(size_t size)
+{
+    char* buf;
+    size_t buflen;
+    FILE* out = open_memstream(&buf, &buflen);
+
+    for (int i = 0; buflen < size; ++i)
+    {
+        fprintf(out, "/*\n * generated table %d\n * ", i);
+        for (int j = 0; j < 8; ++j)
+            fprintf(out, "lorem ipsum dolor sit amet consectetur adipiscing elit\n * ");
+        fprintf(out, "\n */\n");
+        fprintf(out, "int table_%d(int index_value, int other_value) {\n", i);
+        for (int j = 0; j < 8; ++j)
+            fprintf(out, "    char* s%d = \"string table entry %d with an \\\"escaped\\\" quote and some padding text\";\n", j, j);
+        fprintf(out, "    int accumulator_value = index_value * %d + other_value;   // trailing comment\n", i);
+        fprintf(out, "    return accumulator_value;\n}\n\n");
+        fflush(out);
+    }
+    fclose(out);
+    return buf;
+}
+
+static char* slurp(char* path)
+{
+    FILE* fp = fopen(path, "r");
+    if (!fp)
+        error("cannot open %s: %s", path, strerror(errno));
+
+    char* buf;
+    size_t buflen;
+    FILE* out = open_memstream(&buf, &buflen);
+    char tmp[4096];
+    size_t n;
+    while ((n = fread(tmp, 1, sizeof(tmp), fp)))
+        fwrite(tmp, 1, n, out);
+    fclose(fp);
+    fclose(out);
+    return buf;
+}
+
+static double now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void bench(char* name, char* input, int iterations)
+{
+    double size = strlen(input);
+    static char* kernels[] = { "scalar", "sse2", "avx2" };
+
+    for (int i = 0; i < sizeof(kernels) / sizeof(*kernels); ++i)
+    {
+        if (!select_scan_kernels(kernels[i]))
+            continue;
+
+        double best = 1e9;
+        for (int j = 0; j < iterations; ++j)
+        {
+            double start = now();
+            tokenize(name, input);
+            double elapsed = now() - start;
+            if (elapsed < best)
+                best = elapsed;
+        }
+        printf("%-24s %-8s %8.1f MB/s\n", name, kernels[i], size / best / 1e6);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    int iterations = 10;
+    int i = 1;
+    cc = new_compiler();
+
+    if (i + 1 < argc && !strcmp(argv[i], "-n"))
+    {
+        iterations = atoi(argv[i + 1]);
+        i += 2;
+    }
+
+    if (i == argc)
+        bench("<synthetic>", synthetic_input(32 << 20), iterations);
+    for (; i < argc; ++i)
+        bench(argv[i], slurp(argv[i]), iterations);
+    return 0;
+}
@@ -0,0 +1,58 @@
+#!/bin/bash
+# compile time against input size for deeply nested and very long inputs
+# every shape is generated at 1 KB, 10 KB, ... up to the given size (100 MB
+# by default); the time per MB should stay flat as the input grows
+#
+# usage: bench/scale.sh [ <max bytes> ]
+# build the compiler with optimization for meaningful numbers:
+#   make clean && make CFLAGS="-std=c11 -O2 -fno-common -pthread"
+
+max=${1:-100000000}
+tmp=$(mktemp -d /tmp/au_cc-scale-XXXXXX)
+trap 'rm -rf $tmp' EXIT
+
+# prints a translation unit of about $2 bytes of the shape $1
+generate() {
+    awk -v shape=$1 -v size=$2 'BEGIN {
+        if (shape == "parens") {
+            n = int(size / 2);
+            printf "int main() { return ";
+            for (i = 0; i < n; i++) printf "(";
+            printf "1";
+            for (i = 0; i < n; i++) printf ")";
+            print "; }";
+        } else if (shape == "chain") {
+            n = int(size / 4);
+            printf "int main() { int x = 1; return x";
+            for (i = 0; i < n; i++) printf " + x";
+            print "; }";
+        } else if (shape == "blocks") {
+            n = int(size / 4);
+            printf "int main() { ";
+            for (i = 0; i < n; i++) printf "{ ";
+            printf "return 1;";
+            for (i = 0; i < n; i++) printf " }";
+            print " }";
+        } else if (shape == "stmt-exprs") {
+            n = int(size / 7);
+            printf "int main() { return ";
+            for (i = 0; i < n; i++) printf "({ ";
+            printf "1;";
+            for (i = 0; i < n; i++) printf " });";
+            print " }";
+        }
+    }'
+}
+
+printf "%-12s %12s %10s %10s\n" shape bytes seconds "s/MB"
+for shape in parens chain blocks stmt-exprs; do
+    for ((size = 1000; size <= max; size *= 10)); do
+        generate $shape $size > $tmp/in.c
+        bytes=$(stat -c %s $tmp/in.c)
+        start=$(date +%s.%N)
+        ./au_cc -o /dev/null $tmp/in.c || exit 1
+        end=$(date +%s.%N)
+        awk -v s=$shape -v b=$bytes -v t0=$start -v t1=$end \
+            'BEGIN { printf "%-12s %12d %10.3f %10.3f\n", s, b, t1 - t0, (t1 - t0) / (b / 1e6) }'
+    done
+done
@@ -0,0 +1,352 @@
+// on-disk compilation cache, shared by the compilers using the same directory
+// an entry is named by a hash of the input bytes, of the options that change
+// the output and of the compiler binary; it holds the assembly, and a hash of
+// each file the input included, which are only known once it is compiled:
+// an entry is a miss if any of them changed, or if a file was created where an
+// #include searched before finding its file, as it would now be included
+// the hashes are those of the very bytes compiled, so a file edited during
+// the compilation cannot be cached under a hash of its new contents
+//
+// entries are written to a temporary file renamed into place, so a reader
+// never sees a partial entry, and compilers can share a directory; the hit
+// and miss counts and the total size are kept in the stats file under
+// flock(), and once the size exceeds the limit, the least recently used
+// entries are removed (a hit refreshes the mtime of its entry)
+
+#include "au_cc.h"
+#include <dirent.h>
+#include <sys/file.h>
+
+struct Cache
+{
+    char* dir;
+    int64_t max_size; // 0 for no limit
+
+    // counts of this process, added to the stats file by close_cache()
+    pthread_mutex_t lock;
+    int64_t hits;
+    int64_t misses;
+    int64_t added; // bytes of the entries stored
+};
+
+typedef struct
+{
+    int64_t hits;
+    int64_t misses;
+    int64_t size;
+} CacheStats;
+
+static char* read_path(char* path, size_t* len)
+{
+    FILE* fp = fopen(path, "r");
+    if (!fp)
+        return NULL;
+    char* buf = read_file(fp, len);
+    fclose(fp);
+    return buf;
+}
+
+// returns the hash of the contents of the file at path, or NULL
+static char* hash_file(char* path)
+{
+    size_t len;
+    char* buf = read_path(path, &len);
+    if (!buf)
+        return NULL;
+    char* hash = format_hash(hash_bytes(HASH_INIT, buf, len));
+    free(buf);
+    return hash;
+}
+
+static Hash build_id;
+
+static void hash_compiler(void)
+{
+    size_t len;
+    char* buf = read_path("/proc/self/exe", &len);
+    if (buf)
+        build_id = hash_bytes(HASH_INIT, buf, len);
+    else
+        build_id = hash_string(HASH_INIT, __DATE__ " " __TIME__);
+    free(buf);
+}
+
+// identifies the compiler by a hash of its binary, so that rebuilding it
+// invalidates what it cached
+Hash compiler_id(void)
+{
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+    pthread_once(&once, hash_compiler);
+    return build_id;
+}
+
+// returns the name of the entry for the size bytes at src, read from the file
+// at input, compiled with the given include directories
+char* cache_key(char* input, char* src, size_t size, char** include_paths, int num_include_paths)
+{
+    Hash id = compiler_id();
+    Hash h = hash_bytes(HASH_INIT, &id, sizeof(id));
+    h = hash_string(h, input); // names the file in the assembly
+    h = hash_bytes(h, &num_include_paths, sizeof(num_include_paths));
+    for (int i = 0; i < num_include_paths; ++i)
+        h = hash_string(h, include_paths[i]);
+    h = hash_bytes(h, src, size);
+    return format_hash(h);
+}
+
+Cache* open_cache(char* dir, int64_t max_size)
+{
+    Cache* cache = calloc(1, sizeof(Cache));
+    cache->dir = dir;
+    cache->max_size = max_size;
+    pthread_mutex_init(&cache->lock, NULL);
+    return cache;
+}
+
+static char* entry_path(Cache* cache, char* key)
+{
+    return format("%s/%.2s/%s", cache->dir, key, key + 2);
+}
+
+static void add_count(Cache* cache, int64_t* count, int64_t n)
+{
+    pthread_mutex_lock(&cache->lock);
+    *count += n;
+    pthread_mutex_unlock(&cache->lock);
+}
+
+// an entry is a line "dep <hash> <path>" per included file, a line
+// "missing <path>" per path searched and not found, an empty line, then the
+// assembly
+// returns the assembly, moved to the start of buf, if no included file changed
+static char* check_entry(char* buf, size_t size, size_t* len)
+{
+    char* p = buf;
+    while (*p != '\n')
+    {
+        char* end = strchr(p, '\n');
+        if (!end)
+            return NULL;
+        *end = '\0';
+        if (!strncmp(p, "missing ", 8))
+        {
+            if (access(p + 8, F_OK) == 0)
+                return NULL;
+            p = end + 1;
+            continue;
+        }
+        if (strncmp(p, "dep ", 4) || end - p < 38 || p[36] != ' ')
+            return NULL;
+        char* hash = hash_file(p + 37);
+        bool same = hash && !strncmp(hash, p + 4, 32);
+        free(hash);
+        if (!same)
+            return NULL;
+        p = end + 1;
+    }
+
+    ++p;
+    *len = size - (p - buf);
+    memmove(buf, p, *len + 1);
+    return buf;
+}
+
+// returns the assembly stored under key, or NULL
+char* cache_lookup(Cache* cache, char* key, size_t* len)
+{
+    char* path = entry_path(cache, key);
+    size_t size;
+    char* buf = read_path(path, &size);
+    char* out = buf ? check_entry(buf, size, len) : NULL;
+    if (out)
+        utimensat(AT_FDCWD, path, NULL, 0); // most recently used
+    else
+        free(buf);
+    free(path);
+
+    add_count(cache, out ? &cache->hits : &cache->misses, 1);
+    return out;
+}
+
+// stores the assembly compiled for key, which depends on deps
+void cache_store(Cache* cache, char* key, char* out, size_t len, Dep* deps, int num_deps)
+{
+    char* entry;
+    size_t entry_len;
+    FILE* fp = open_memstream(&entry, &entry_len);
+    for (int i = 0; i < num_deps; ++i)
+    {
+        if (deps[i].missing)
+        {
+            fprintf(fp, "missing %s\n", deps[i].path);
+            continue;
+        }
+        char* hash = format_hash(deps[i].hash);
+        fprintf(fp, "dep %s %s\n", hash, deps[i].path);
+        free(hash);
+    }
+    fputc('\n', fp);
+    fwrite(out, 1, len, fp);
+    fclose(fp);
+
+    char* subdir = format("%s/%.2s", cache->dir, key);
+    mkdir(cache->dir, 0777);
+    mkdir(subdir, 0777);
+    char* tmp = format("%s/.tmp.XXXXXX", subdir);
+    char* path = entry_path(cache, key);
+
+    int fd = mkstemp(tmp);
+    if (fd >= 0)
+    {
+        FILE* f = fdopen(fd, "w");
+        bool ok = fwrite(entry, 1, entry_len, f) == entry_len;
+        ok &= fclose(f) == 0;
+        // an entry replaced (after a miss on a changed dep) is no longer counted
+        struct stat old;
+        int64_t replaced = stat(path, &old) == 0 ? old.st_size : 0;
+        if (ok && rename(tmp, path) == 0)
+            add_count(cache, &cache->added, entry_len - replaced);
+        else
+            unlink(tmp);
+    }
+
+    free(path);
+    free(tmp);
+    free(subdir);
+    free(entry);
+}
+
+static CacheStats read_stats(int fd)
+{
+    CacheStats st = {};
+    char buf[256];
+    ssize_t n = pread(fd, buf, sizeof(buf) - 1, 0);
+    if (n > 0)
+    {
+        buf[n] = '\0';
+        long long hits, misses, size;
+        if (sscanf(buf, "hits %lld\nmisses %lld\nsize %lld", &hits, &misses, &size) == 3)
+            st = (CacheStats){ hits, misses, size };
+    }
+    return st;
+}
+
+static void write_stats(int fd, CacheStats* st)
+{
+    char* buf = format("hits %lld\nmisses %lld\nsize %lld\n", (long long)st->hits,
+                       (long long)st->misses, (long long)st->size);
+    if (ftruncate(fd, 0) == 0)
+        pwrite(fd, buf, strlen(buf), 0);
+    free(buf);
+}
+
+typedef struct
+{
+    char* path;
+    time_t mtime;
+    int64_t size;
+} Entry;
+
+static int compare_mtime(const void* a, const void* b)
+{
+    time_t x = ((Entry*)a)->mtime;
+    time_t y = ((Entry*)b)->mtime;
+    return x < y ? -1 : x > y;
+}
+
+// removes the least recently used entries down to 90% of the limit, which
+// leaves room for a while before the next time; returns the size left
+static int64_t evict(Cache* cache)
+{
+    Entry* entries = NULL;
+    int num_entries = 0;
+    int capacity = 0;
+    int64_t size = 0;
+
+    DIR* top = opendir(cache->dir);
+    for (struct dirent* d; top && (d = readdir(top));)
+    {
+        if (strlen(d->d_name) != 2 || d->d_name[0] == '.')
+            continue;
+        char* subdir = format("%s/%s", cache->dir, d->d_name);
+        DIR* sub = opendir(subdir);
+        for (struct dirent* e; sub && (e = readdir(sub));)
+        {
+            // temporary files of writers too
+            if (e->d_name[0] == '.')
+                continue;
+            char* path = format("%s/%s", subdir, e->d_name);
+            struct stat st;
+            if (stat(path, &st) != 0)
+            {
+                free(path);
+                continue;
+            }
+            if (num_entries == capacity)
+            {
+                capacity = capacity ? capacity * 2 : 256;
+                entries = realloc(entries, sizeof(Entry) * capacity);
+            }
+            entries[num_entries++] = (Entry){ path, st.st_mtime, st.st_size };
+            size += st.st_size;
+        }
+        if (sub)
+            closedir(sub);
+        free(subdir);
+    }
+    if (top)
+        closedir(top);
+
+    qsort(entries, num_entries, sizeof(Entry), compare_mtime);
+    int64_t target = cache->max_size / 10 * 9;
+    for (int i = 0; i < num_entries; ++i)
+    {
+        if (size > target && unlink(entries[i].path) == 0)
+            size -= entries[i].size;
+        free(entries[i].path);
+    }
+    free(entries);
+    return size;
+}
+
+// adds the counts of this process to the stats of the cache, evicts entries
+// if the cache grew past its limit, and frees cache
+void close_cache(Cache* cache)
+{
+    mkdir(cache->dir, 0777);
+    char* path = format("%s/stats", cache->dir);
+    int fd = open(path, O_RDWR | O_CREAT, 0666);
+    if (fd >= 0 && flock(fd, LOCK_EX) == 0)
+    {
+        CacheStats st = read_stats(fd);
+        st.hits += cache->hits;
+        st.misses += cache->misses;
+        st.size += cache->added;
+        if (cache->max_size && st.size > cache->max_size)
+            st.size = evict(cache);
+        write_stats(fd, &st);
+    }
+    if (fd >= 0)
+        close(fd);
+
+    free(path);
+    pthread_mutex_destroy(&cache->lock);
+    free(cache);
+}
+
+void print_cache_stats(char* dir)
+{
+    char* path = format("%s/stats", dir);
+    int fd = open(path, O_RDONLY);
+    CacheStats st = {};
+    if (fd >= 0)
+    {
+        flock(fd, LOCK_SH);
+        st = read_stats(fd);
+        close(fd);
+    }
+    free(path);
+
+    printf("hits %lld\nmisses %lld\nsize %lld\n", (long long)st.hits, (long long)st.misses,
+           (long long)st.size);
+}
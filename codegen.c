@@ -32,42 +32,78 @@
 
 #include "au_cc.h"
 
-static FILE* output_file;
-static int depth;
 static char* argreg8[] = { "%dil", "%sil", "%dl", "%cl", "%r8b", "%r9b" };
 static char* argreg16[] = { "%di", "%si", "%dx", "%cx", "%r8w", "%r9w" };
 static char* argreg32[] = { "%edi", "%esi", "%edx", "%ecx", "%r8d", "%r9d" };
 static char* argreg64[] = { "%rdi", "%rsi", "%rdx", "%rcx", "%r8", "%r9" };
-static Obj* current_fn;
+
+// the state of the code generator of a compiler (see Compiler)
+struct CodeGen
+{
+    FILE* output_file;
+    int depth;
+    Obj* current_fn;
+    int labels; // number of labels of current_fn
+
+    // set while generating a fragment of an incremental compilation, whose
+    // .loc directives are relative to the function (see emit_loc())
+    bool in_fragment;
+    int fn_file;
+    int fn_line;
+
+    // left operands of a chain of binary operators (ex: a + b + c ...), which is
+    // as deep as it is long; it is walked with a loop rather than by recursion
+    Node** spine;
+    int spine_len;
+    int spine_capacity;
+};
 
 static void gen_expr(Node* node);
 static void gen_stmt(Node* node);
 
 static void println(char* fmt, ...)
 {
+    CodeGen* gen = cc->gen;
     va_list ap;
     va_start(ap, fmt);
-    vfprintf(output_file, fmt, ap);
+    vfprintf(gen->output_file, fmt, ap);
     va_end(ap);
-    fprintf(output_file, "\n");
+    fprintf(gen->output_file, "\n");
 }
 
+// labels are numbered from 1 in each function, and named after it (ex:
+// .L.end.main.1), so that they do not depend on the functions before it
 static int count(void)
 {
-    static int i = 1;
-    return i++;
+    return ++cc->gen->labels;
+}
+
+// a .loc directive of a fragment gives the line relative to the function,
+// or the name of the file if it is not that of the function; these are
+// resolved when the fragment is written out (see write_fragment())
+static void emit_loc(Token* tok)
+{
+    CodeGen* gen = cc->gen;
+    int file = file_number(tok);
+    int line = line_number(tok);
+    if (!gen->in_fragment)
+        println("   .loc %d %d", file, line);
+    else if (file == gen->fn_file)
+        println("   .loc = %d", line - gen->fn_line);
+    else
+        println("   .loc \"%s\" %d", source_file_name(file), line);
 }
 
 static void push(void)
 {
     println("    push %%rax");
-    ++depth;
+    ++cc->gen->depth;
 }
 
 static void pop(char* arg)
 {
     println("    pop %s", arg);
-    --depth;
+    --cc->gen->depth;
 }
 
 // round up 'n' to the nearest multiple of 'align'.
@@ -195,9 +231,95 @@ static void cast(Type* from, Type* to) {
     }
 }
 
+// generated code nests as deep as the input; like the parser, code generation
+// continues on a new stack segment rather than running out of stack
+static void run_gen_expr(void* node)
+{
+    gen_expr(node);
+}
+
+static void run_gen_stmt(void* node)
+{
+    gen_stmt(node);
+}
+
+static bool is_binary(Node* node)
+{
+    switch (node->kind)
+    {
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+    case ND_COMMA:
+        return true;
+    }
+    return false;
+}
+
+static void gen_binary_op(Node* node);
+
+static void gen_binary_chain(Node* node)
+{
+    CodeGen* gen = cc->gen;
+    int base = gen->spine_len;
+    for (; is_binary(node); node = node->lhs)
+    {
+        if (gen->spine_len == gen->spine_capacity)
+        {
+            gen->spine_capacity = gen->spine_capacity ? gen->spine_capacity * 2 : 256;
+            gen->spine = realloc(gen->spine, sizeof(Node*) * gen->spine_capacity);
+        }
+        gen->spine[gen->spine_len++] = node;
+    }
+
+    // the right operand of an operator is evaluated and pushed before the
+    // left one; both operands of "," are evaluated left to right
+    for (int i = base; i < gen->spine_len; ++i)
+    {
+        Node* n = gen->spine[i];
+        emit_loc(n->tok);
+        if (n->kind != ND_COMMA)
+        {
+            gen_expr(n->rhs);
+            push();
+        }
+    }
+
+    gen_expr(node);
+
+    while (gen->spine_len > base)
+    {
+        Node* n = gen->spine[--gen->spine_len];
+        if (n->kind == ND_COMMA)
+        {
+            gen_expr(n->rhs);
+            continue;
+        }
+        pop("%rdi");
+        gen_binary_op(n);
+    }
+}
+
 static void gen_expr(Node* node)
 {
-    println("   .loc 1 %d", node->tok->line_num);
+    if (stack_is_low())
+    {
+        call_with_stack(run_gen_expr, node);
+        return;
+    }
+
+    if (is_binary(node))
+    {
+        gen_binary_chain(node);
+        return;
+    }
+
+    emit_loc(node->tok);
     switch (node->kind)
     {
     case ND_NUM:
@@ -231,10 +353,6 @@ static void gen_expr(Node* node)
             gen_stmt(n);
         }
         return;
-    case ND_COMMA:
-        gen_expr(node->lhs);
-        gen_expr(node->rhs);
-        return;
     case ND_CAST:
         gen_expr(node->lhs);
         cast(node->lhs->ty, node->ty);
@@ -257,11 +375,12 @@ static void gen_expr(Node* node)
     }
     }
 
-    gen_expr(node->rhs);
-    push();
-    gen_expr(node->lhs);
-    pop("%rdi");
+    error_tok(node->tok, "invalide expression");
+}
 
+// applies the binary operator of node to %rax (left) and %rdi (right)
+static void gen_binary_op(Node* node)
+{
     // eax: 32 bit; rax: 64 bit
     char* ax, * di;
 
@@ -313,41 +432,49 @@ static void gen_expr(Node* node)
 
 static void gen_stmt(Node* node)
 {
-    println("   .loc 1 %d", node->tok->line_num);
+    if (stack_is_low())
+    {
+        call_with_stack(run_gen_stmt, node);
+        return;
+    }
+
+    emit_loc(node->tok);
 
     switch (node->kind)
     {
     case ND_IF:
     {
+        char* fn = cc->gen->current_fn->name;
         int c = count();
         gen_expr(node->cond);
         println("    cmp $0, %%rax");
-        println("    je .L.else.%d", c);
+        println("    je .L.else.%s.%d", fn, c);
         gen_stmt(node->then);
-        println("    jmp .L.end.%d", c);
-        println(".L.else.%d:", c);
+        println("    jmp .L.end.%s.%d", fn, c);
+        println(".L.else.%s.%d:", fn, c);
         if (node->els)
             gen_stmt(node->els);
-        println(".L.end.%d:", c);
+        println(".L.end.%s.%d:", fn, c);
         return;
     }
     case ND_FOR:
     {
+        char* fn = cc->gen->current_fn->name;
         int c = count();
         if (node->init)
             gen_stmt(node->init);
-        println(".L.begin.%d:", c);
+        println(".L.begin.%s.%d:", fn, c);
         if (node->cond)
         {
             gen_expr(node->cond);
             println("    cmp $0, %%rax");
-            println("    je .L.end.%d", c);
+            println("    je .L.end.%s.%d", fn, c);
         }
         gen_stmt(node->then);
         if (node->inc)
             gen_expr(node->inc);
-        println("    jmp .L.begin.%d", c);
-        println(".L.end.%d:", c);
+        println("    jmp .L.begin.%s.%d", fn, c);
+        println(".L.end.%s.%d:", fn, c);
         return;
     }
     case ND_BLOCK:
@@ -358,7 +485,7 @@ static void gen_stmt(Node* node)
         return;
     case ND_RETURN:
         gen_expr(node->lhs);
-        println("    jmp .L.return.%s", current_fn->name);
+        println("    jmp .L.return.%s", cc->gen->current_fn->name);
         return;
     case ND_EXPR_STMT:
         gen_expr(node->lhs);
@@ -386,29 +513,39 @@ static void assign_lvar_offsets(Obj* prog)
     }
 }
 
-static void emit_data(Obj* prog)
+static void emit_gvar(Obj* var)
 {
-    for (Obj* var = prog; var; var = var->next)
-    {
-        if (var->is_function)
-            continue;
-
-        println("    .data");
+    println("    .data");
+    if (!var->is_static)
         println("    .global %s", var->name);
-        println("%s:", var->name);
+    println("%s:", var->name);
 
-        if (var->init_data)
+    if (var->init_data)
+    {
+        Relocation* rel = var->rel;
+        for (int i = 0; i < var->ty->size;)
         {
-            for (int i = 0; i < var->ty->size; ++i)
+            if (rel && rel->offset == i)
             {
-                println("    .byte %d", var->init_data[i]);
+                println("    .quad %s%+ld", rel->label, rel->addend);
+                rel = rel->next;
+                i += 8;
             }
-        }
-        else
-        {
-            println("    .zero %d", var->ty->size);
+            else
+                println("    .byte %d", var->init_data[i++]);
         }
     }
+    else
+    {
+        println("    .zero %d", var->ty->size);
+    }
+}
+
+static void emit_data(Obj* prog)
+{
+    for (Obj* var = prog; var; var = var->next)
+        if (!var->is_function)
+            emit_gvar(var);
 }
 
 static void store_gp(int r, int offset, int sz)
@@ -430,43 +567,143 @@ static void store_gp(int r, int offset, int sz)
     }
 }
 
+static void emit_function(Obj* func)
+{
+    CodeGen* gen = cc->gen;
+    gen->current_fn = func;
+    gen->labels = 0;
+
+    // string literals are private to the function (.L..<name>.<n>)
+    for (Obj* var = func->literals; var; var = var->next)
+        emit_gvar(var);
+
+    if (!func->is_static)
+        println("    .global %s", func->name);
+    println("    .text");
+    println("%s:", func->name);
+
+    // prologue
+    println("    push %%rbp");
+    println("    mov %%rsp, %%rbp");
+    println("    sub $%d, %%rsp", func->stack_size);
+
+    // save passed-by-register arguments to the stack
+    int i = 0;
+    for (Obj* var = func->params; var; var = var->next)
+        store_gp(i++, var->offset, var->ty->size);
+
+    // emit code
+    gen_stmt(func->body);
+    assert(gen->depth == 0);
+
+    println(".L.return.%s:", func->name);
+    println("    mov %%rbp, %%rsp");
+    println("    pop %%rbp");
+    println("    ret");
+}
+
+// returns the number of the source file named name
+static int file_named(char* name, int len)
+{
+    for (int i = 1; i <= num_source_files(); ++i)
+        if (!strncmp(source_file_name(i), name, len) && !source_file_name(i)[len])
+            return i;
+    unreachable();
+    return 0;
+}
+
+// writes frag as the assembly of func, with its .loc directives resolved
+static void write_fragment(Fragment* frag, Obj* func)
+{
+    FILE* out = cc->gen->output_file;
+    int file = file_number(func->body_tok);
+    int line = line_number(func->body_tok);
+
+    char* p = frag->text; // the text before p is written
+    char* end = p + frag->len;
+    for (char* s = p; s < end;)
+    {
+        char* eol = memchr(s, '\n', end - s);
+        if (!eol)
+            break;
+        if (!strncmp(s, "   .loc ", 8))
+        {
+            fwrite(p, 1, s - p, out);
+            char* arg = s + 8;
+            if (*arg == '=')
+                fprintf(out, "   .loc %d %d", file, line + atoi(arg + 1));
+            else
+            {
+                char* name_end = eol - 1;
+                while (*name_end != ' ')
+                    --name_end;
+                fprintf(out, "   .loc %d %.*s", file_named(arg + 1, name_end - arg - 2),
+                        (int)(eol - name_end - 1), name_end + 1);
+            }
+            p = eol;
+        }
+        s = eol + 1;
+    }
+    fwrite(p, 1, end - p, out);
+}
+
+// an incremental compilation writes every function as a fragment, which is
+// generated unless the parser found one that can be reused (see fncache.c)
 static void emit_text(Obj* prog)
 {
+    CodeGen* gen = cc->gen;
     for (Obj* func = prog; func; func = func->next)
     {
         if (!func->is_function || !func->is_definition)
             continue;
-        println("    .global %s", func->name);
-        println("    .text");
-        println("%s:", func->name);
-        current_fn = func;
-
-        // prologue
-        println("    push %%rbp");
-        println("    mov %%rsp, %%rbp");
-        println("    sub $%d, %%rsp", func->stack_size);
-
-        // save passed-by-register arguments to the stack
-        int i = 0;
-        for (Obj* var = func->params; var; var = var->next)
-            store_gp(i++, var->offset, var->ty->size);
-
-        // emit code
-        gen_stmt(func->body);
-        assert(depth == 0);
-
-        println(".L.return.%s:", func->name);
-        println("    mov %%rbp, %%rsp");
-        println("    pop %%rbp");
-        println("    ret");
+        if (!cc->fns)
+        {
+            emit_function(func);
+            continue;
+        }
+
+        Fragment* frag = func->fragment;
+        if (!frag)
+        {
+            frag = calloc(1, sizeof(Fragment));
+            frag->hash = func->hash;
+            frag->num_refs = func->num_refs;
+            frag->refs = calloc(func->num_refs, sizeof(char*));
+            for (int i = 0; i < func->num_refs; ++i)
+                frag->refs[i] = func->refs[i]->name;
+
+            FILE* out = gen->output_file;
+            gen->output_file = open_memstream(&frag->text, &frag->len);
+            gen->in_fragment = true;
+            gen->fn_file = file_number(func->body_tok);
+            gen->fn_line = line_number(func->body_tok);
+            emit_function(func);
+            fclose(gen->output_file);
+            gen->output_file = out;
+            gen->in_fragment = false;
+        }
+        keep_fragment(cc->fns, frag);
+        write_fragment(frag, func);
     }
 }
 
 void codegen(Obj* prog, FILE* out)
 {
-    output_file = out;
+    CodeGen* gen = cc->gen;
+    gen->output_file = out;
+    gen->depth = 0;
 
     assign_lvar_offsets(prog);
     emit_data(prog);
     emit_text(prog);
-}
\ No newline at end of file
+}
+CodeGen* new_codegen(void)
+{
+    return calloc(1, sizeof(CodeGen));
+}
+
+void free_codegen(CodeGen* gen)
+{
+    free(gen->spine);
+    free(gen);
+}
@@ -0,0 +1,207 @@
+// compiler contexts and the embedding interface (see libau_cc.h)
+// a compilation runs with its compiler current on the calling thread (cc);
+// the messages of an error are written to the compiler, and the error unwinds
+// the compilation with longjmp() to compile(), which returns it as a value
+
+#include "au_cc.h"
+
+_Thread_local Compiler* cc;
+
+// where error messages go: the compiler's own messages while it compiles,
+// stderr otherwise (ex: a command line error of the driver)
+FILE* error_output(void)
+{
+    return cc && cc->diag ? cc->diag : stderr;
+}
+
+// ends the compilation in progress after an error, or the process if none is
+void error_return(void)
+{
+    if (cc && cc->on_error)
+        longjmp(*cc->on_error, 1);
+    exit(1);
+}
+
+static void clear_deps(Compiler* c)
+{
+    for (int i = 0; i < c->num_deps; ++i)
+        free(c->deps[i].path);
+    free(c->deps);
+    c->deps = NULL;
+    c->num_deps = 0;
+    c->dep_capacity = 0;
+}
+
+static void add_dep(Compiler* c, Dep dep)
+{
+    if (c->num_deps == c->dep_capacity)
+    {
+        c->dep_capacity = c->dep_capacity ? c->dep_capacity * 2 : 16;
+        c->deps = realloc(c->deps, sizeof(Dep) * c->dep_capacity);
+    }
+    c->deps[c->num_deps++] = dep;
+}
+
+// records that an #include searched path before finding its file
+void add_missing_dep(char* path)
+{
+    if (cc->record_deps)
+        add_dep(cc, (Dep){ strdup(path), .missing = true });
+}
+
+Compiler* new_compiler(void)
+{
+    Compiler* c = calloc(1, sizeof(Compiler));
+    c->names = new_intern_table();
+    c->lexer = new_lexer();
+    c->pp = new_preprocessor();
+    c->parser = new_parser();
+    c->types = new_type_table();
+    c->gen = new_codegen();
+    return c;
+}
+
+void free_compiler(Compiler* c)
+{
+    free_intern_table(c->names);
+    free_lexer(c->lexer);
+    free_preprocessor(c->pp);
+    free_parser(c->parser);
+    free_type_table(c->types);
+    free_codegen(c->gen);
+    free(c->error);
+    free(c->base_dir);
+    free(c->fn_cache_path);
+    clear_deps(c);
+    free(c);
+}
+
+void compiler_add_include_path(Compiler* c, char* dir)
+{
+    Compiler* saved = cc;
+    cc = c;
+    add_include_path(dir);
+    cc = saved;
+}
+
+void compiler_clear_include_paths(Compiler* c)
+{
+    Compiler* saved = cc;
+    cc = c;
+    clear_include_paths();
+    cc = saved;
+}
+
+void compiler_set_base_dir(Compiler* c, char* dir)
+{
+    free(c->base_dir);
+    c->base_dir = dir ? strdup(dir) : NULL;
+}
+
+void compiler_set_fn_cache(Compiler* c, char* path)
+{
+    free(c->fn_cache_path);
+    c->fn_cache_path = path ? strdup(path) : NULL;
+}
+
+char* compiler_error(Compiler* c)
+{
+    return c->error;
+}
+
+// releases everything of the translation unit but the interned names, which
+// the next one is likely to share
+static void end_translation_unit(void)
+{
+    reset_parser();
+    reset_types();
+    reset_preprocessor();
+    reset_lexer();
+    free(cc->source);
+    cc->source = NULL;
+    if (cc->fns)
+        free_fn_cache(cc->fns);
+    cc->fns = NULL;
+}
+
+// compiles the file at path, or the source text src of size bytes if given
+static int compile(Compiler* c, char* path, char* src, size_t size, char** out, size_t* out_len)
+{
+    Compiler* saved = cc;
+    cc = c;
+
+    free(c->error);
+    c->error = NULL;
+    clear_deps(c);
+    char* msg;
+    size_t msg_len;
+    c->diag = open_memstream(&msg, &msg_len);
+
+    char* buf;
+    size_t len;
+    FILE* asm_out = open_memstream(&buf, &len);
+
+    jmp_buf env;
+    c->on_error = &env;
+    volatile bool ok = false;
+    if (c->fn_cache_path)
+        c->fns = load_fn_cache(c->fn_cache_path);
+    if (!setjmp(env))
+    {
+        Token* tok;
+        if (src)
+        {
+            // the lexer needs the input terminated by '\0'
+            c->source = malloc(size + 1);
+            memcpy(c->source, src, size);
+            c->source[size] = '\0';
+            tok = tokenize_source(path, c->source, size);
+        }
+        else
+            tok = tokenize_file(path);
+        Obj* prog = parse(preprocess(tok));
+
+        // included files are known once the whole input has been parsed
+        for (int i = 1; i <= num_source_files(); ++i)
+            fprintf(asm_out, ".file %d \"%s\"\n", i, source_file_name(i));
+        if (c->record_deps)
+            for (int i = 2; i <= num_source_files(); ++i)
+                add_dep(c, (Dep){ strdup(source_file_name(i)), source_file_hash(i) });
+        codegen(prog, asm_out);
+        if (c->fns)
+            save_fn_cache(c->fns, c->fn_cache_path);
+        ok = true;
+    }
+    else
+        reset_stack();
+
+    c->on_error = NULL;
+    fclose(c->diag);
+    c->diag = NULL;
+    fclose(asm_out);
+    end_translation_unit();
+    cc = saved;
+
+    if (!ok)
+    {
+        free(buf);
+        c->error = msg;
+        return -1;
+    }
+    free(msg);
+    *out = buf;
+    *out_len = len;
+    return 0;
+}
+
+int compile_source(Compiler* c, char* name, char* src, size_t size, char** out, size_t* out_len)
+{
+    if (!src)
+        src = "";
+    return compile(c, name, src, size, out, out_len);
+}
+
+int compile_file(Compiler* c, char* path, char** out, size_t* out_len)
+{
+    return compile(c, path, NULL, 0, out, out_len);
+}
@@ -0,0 +1,206 @@
+// per-function incremental compilation
+// the assembly of each function definition is kept in a sidecar file of the
+// output, under a fingerprint of the definition: its tokens and what its
+// names refer to at file scope (see fingerprint() in parse.c); a function whose
+// fingerprint is found is neither parsed nor generated again, and its stored
+// assembly is spliced into the output instead (see emit_text() in codegen.c)
+//
+// a fragment must not depend on where the function is: its labels are named
+// after the function, and its .loc directives are relative to the function
+// until they are written out
+//
+// the sidecar file holds the build identity of the compiler, then every
+// fragment of the last compilation as a line "<hash> <refs> <size>", the
+// names of the static functions the body references one per line, and the
+// assembly; it is replaced as a whole by rename()
+
+#include "au_cc.h"
+
+struct FnCache
+{
+    char* buf; // contents of the sidecar file, which loaded fragments point into
+    Fragment* loaded; // sorted by hash
+    int num_loaded;
+
+    // fragments of the current compilation, saved for the next one
+    Fragment** kept;
+    int num_kept;
+    int kept_capacity;
+};
+
+static int compare_hash(const void* a, const void* b)
+{
+    Hash x = ((Fragment*)a)->hash;
+    Hash y = ((Fragment*)b)->hash;
+    return x < y ? -1 : x > y;
+}
+
+static bool parse_hash(char* s, Hash* h)
+{
+    *h = 0;
+    for (int i = 0; i < 32; ++i)
+    {
+        int c = s[i];
+        int d = c >= '0' && c <= '9' ? c - '0' : c >= 'a' && c <= 'f' ? c - 'a' + 10 : -1;
+        if (d < 0)
+            return false;
+        *h = *h << 4 | d;
+    }
+    return true;
+}
+
+// reads the fragments of the sidecar file at path; a missing or unreadable
+// file, or one written by another build of the compiler, has none
+FnCache* load_fn_cache(char* path)
+{
+    FnCache* fns = calloc(1, sizeof(FnCache));
+    // the file is as large as the output, so it is read in one piece
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0)
+        return fns;
+    if (fstat(fd, &st) != 0 || st.st_size < 33)
+    {
+        close(fd);
+        return fns;
+    }
+    size_t size = st.st_size;
+    fns->buf = malloc(size + 1);
+    bool ok = read(fd, fns->buf, size) == (ssize_t)size;
+    close(fd);
+    if (!ok)
+        return fns;
+    fns->buf[size] = '\0';
+
+    char* p = fns->buf;
+    char* end = p + size;
+    char* id = format_hash(compiler_id());
+    bool same_build = !strncmp(p, id, 32) && p[32] == '\n';
+    free(id);
+    if (!same_build)
+        return fns;
+    p += 33;
+
+    int capacity = 0;
+    while (p < end)
+    {
+        Fragment frag = {};
+        char* q;
+        if (end - p < 33 || !parse_hash(p, &frag.hash) || p[32] != ' ')
+            break;
+        frag.num_refs = strtol(p + 33, &q, 10);
+        frag.len = strtoul(q, &q, 10);
+        if (*q != '\n' || frag.num_refs < 0)
+            break;
+        p = q + 1;
+
+        frag.refs = calloc(frag.num_refs, sizeof(char*));
+        for (int i = 0; i < frag.num_refs && p; ++i)
+        {
+            frag.refs[i] = p;
+            p = memchr(p, '\n', end - p);
+            if (p)
+                *p++ = '\0';
+        }
+        if (!p || (size_t)(end - p) < frag.len)
+        {
+            free(frag.refs);
+            break;
+        }
+        frag.text = p;
+        p += frag.len;
+
+        if (fns->num_loaded == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 64;
+            fns->loaded = realloc(fns->loaded, sizeof(Fragment) * capacity);
+        }
+        fns->loaded[fns->num_loaded++] = frag;
+    }
+
+    qsort(fns->loaded, fns->num_loaded, sizeof(Fragment), compare_hash);
+    return fns;
+}
+
+Fragment* find_fragment(FnCache* fns, Hash hash)
+{
+    if (!fns->num_loaded)
+        return NULL;
+    Fragment key = { .hash = hash };
+    return bsearch(&key, fns->loaded, fns->num_loaded, sizeof(Fragment), compare_hash);
+}
+
+// keeps frag for the next compilation; a fragment that is not loaded is
+// owned by fns from then on
+void keep_fragment(FnCache* fns, Fragment* frag)
+{
+    if (fns->num_kept == fns->kept_capacity)
+    {
+        fns->kept_capacity = fns->kept_capacity ? fns->kept_capacity * 2 : 64;
+        fns->kept = realloc(fns->kept, sizeof(Fragment*) * fns->kept_capacity);
+    }
+    fns->kept[fns->num_kept++] = frag;
+}
+
+static bool is_loaded(FnCache* fns, Fragment* frag)
+{
+    return frag >= fns->loaded && frag < fns->loaded + fns->num_loaded;
+}
+
+// writes the kept fragments to the sidecar file at path, unless they are
+// those it holds already
+void save_fn_cache(FnCache* fns, char* path)
+{
+    bool changed = fns->num_kept != fns->num_loaded;
+    for (int i = 0; i < fns->num_kept && !changed; ++i)
+        changed = !is_loaded(fns, fns->kept[i]);
+    if (!changed)
+        return;
+
+    char* tmp = format("%s.XXXXXX", path);
+    int fd = mkstemp(tmp);
+    if (fd < 0)
+    {
+        free(tmp);
+        return;
+    }
+
+    fchmod(fd, 0644);
+    FILE* fp = fdopen(fd, "w");
+    char* id = format_hash(compiler_id());
+    fprintf(fp, "%s\n", id);
+    free(id);
+    for (int i = 0; i < fns->num_kept; ++i)
+    {
+        Fragment* frag = fns->kept[i];
+        char* hash = format_hash(frag->hash);
+        fprintf(fp, "%s %d %zu\n", hash, frag->num_refs, frag->len);
+        free(hash);
+        for (int j = 0; j < frag->num_refs; ++j)
+            fprintf(fp, "%s\n", frag->refs[j]);
+        fwrite(frag->text, 1, frag->len, fp);
+    }
+
+    if (fclose(fp) != 0 || rename(tmp, path) != 0)
+        unlink(tmp);
+    free(tmp);
+}
+
+void free_fn_cache(FnCache* fns)
+{
+    for (int i = 0; i < fns->num_kept; ++i)
+    {
+        Fragment* frag = fns->kept[i];
+        if (is_loaded(fns, frag))
+            continue;
+        free(frag->text);
+        free(frag->refs);
+        free(frag);
+    }
+    for (int i = 0; i < fns->num_loaded; ++i)
+        free(fns->loaded[i].refs);
+    free(fns->loaded);
+    free(fns->kept);
+    free(fns->buf);
+    free(fns);
+}
@@ -0,0 +1,39 @@
+// embedding interface of the compiler (libau_cc.a)
+// a Compiler holds options and reusable state; it compiles one translation
+// unit at a time, and compilers used on different threads are independent
+// errors are returned, never printed: the process is not exited on bad input
+
+#ifndef LIBAU_CC_H
+#define LIBAU_CC_H
+
+#include <stddef.h>
+
+typedef struct Compiler Compiler;
+
+Compiler* new_compiler(void);
+void free_compiler(Compiler* c);
+
+// directories searched by #include <...>, in the order they are added
+void compiler_add_include_path(Compiler* c, char* dir);
+void compiler_clear_include_paths(Compiler* c);
+
+// directory from which relative paths (inputs, #include and include
+// directories) are opened; NULL is the working directory of the process
+void compiler_set_base_dir(Compiler* c, char* dir);
+
+// keeps the assembly of each function in the file at path, and reuses it for
+// the functions that did not change since the last compilation; NULL stops
+void compiler_set_fn_cache(Compiler* c, char* path);
+
+// compiles the size bytes at src, named name in messages, to x86-64 assembly
+// on success, returns 0 and sets *out to a '\0'-terminated buffer of *out_len
+// bytes that the caller frees; on error, returns -1 (see compiler_error())
+int compile_source(Compiler* c, char* name, char* src, size_t size, char** out, size_t* out_len);
+
+// compiles the file at path, or stdin if path is "-"
+int compile_file(Compiler* c, char* path, char** out, size_t* out_len);
+
+// messages of the last compilation if it failed, or NULL; owned by c
+char* compiler_error(Compiler* c);
+
+#endif
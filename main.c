@@ -2,14 +2,75 @@
 
 static char* opt_o;
 
-static char* input_path;
+// 0 uses every core
+static int opt_j = 1;
+
+static int lex_threads;
+
+// socket of the compile server, when running as one or as its client
+static char* opt_server;
+static char* opt_connect;
+
+// opt-in cache of compiled files (see cache.c)
+static char* opt_cache_dir;
+static int64_t opt_cache_size = 1 << 30;
+static bool opt_cache_stats;
+static Cache* cache;
+
+// keep the assembly of each function next to the output (see fncache.c)
+static bool opt_incremental;
+
+static char** include_paths;
+static int num_include_paths;
+
+// one per input file; the inputs of a batch are compiled concurrently, but
+// their messages are reported in the order of the command line
+typedef struct
+{
+    char* input;
+    char* output;
+    char* error; // messages if the compilation failed
+} Job;
+
+static Job* jobs;
+static int num_jobs;
+
+static int next_job;
+static pthread_mutex_t next_job_lock = PTHREAD_MUTEX_INITIALIZER;
 
 static void usage(int status)
 {
-    fprintf(stderr, "au_cc [ -o <path> ] <file>\n");
+    fprintf(stderr, "au_cc [ -o <path> ] [ -I <dir> ] [ -j <n> ] [ --lex-threads=<n> ] [ --connect=<socket> ]\n"
+                    "      [ --cache-dir=<dir> ] [ --cache-size=<n>[KMG] ] [ --incremental ] <file>...\n"
+                    "au_cc --server=<socket>\n"
+                    "au_cc --cache-dir=<dir> --cache-stats\n");
     exit(status);
 }
 
+static int parse_count(char* arg)
+{
+    char* end;
+    long n = strtol(arg, &end, 10);
+    if (!*arg || *end || n < 0 || n > INT_MAX)
+        usage(1);
+    return n;
+}
+
+// a size in bytes, or in KiB, MiB or GiB with a suffix
+static int64_t parse_size(char* arg)
+{
+    char* end;
+    long long n = strtoll(arg, &end, 10);
+    int shift = 0;
+    if (*end && !end[1])
+        shift = *end == 'K' ? 10 : *end == 'M' ? 20 : *end == 'G' ? 30 : -1;
+    else if (*end)
+        shift = -1;
+    if (end == arg || shift < 0 || n < 0 || n > INT64_MAX >> shift)
+        usage(1);
+    return (int64_t)n << shift;
+}
+
 static void parse_args(int argc, char** argv)
 {
     for (int i = 1; i < argc; ++i)
@@ -33,40 +94,290 @@ static void parse_args(int argc, char** argv)
             continue;
         }
 
+        // directories searched by #include
+        if (!strcmp(argv[i], "-I"))
+        {
+            if (!argv[++i])
+                usage(1);
+            include_paths = realloc(include_paths, sizeof(char*) * (num_include_paths + 1));
+            include_paths[num_include_paths++] = argv[i];
+            continue;
+        }
+
+        if (!strncmp(argv[i], "-I", 2))
+        {
+            include_paths = realloc(include_paths, sizeof(char*) * (num_include_paths + 1));
+            include_paths[num_include_paths++] = argv[i] + 2;
+            continue;
+        }
+
+        // number of files compiled at a time
+        if (!strcmp(argv[i], "-j"))
+        {
+            if (!argv[++i])
+                usage(1);
+            opt_j = parse_count(argv[i]);
+            continue;
+        }
+
+        if (!strncmp(argv[i], "-j", 2))
+        {
+            opt_j = parse_count(argv[i] + 2);
+            continue;
+        }
+
+        // 0 picks the number of lexer threads from the input size; 1 lexes serially
+        if (!strncmp(argv[i], "--lex-threads=", 14))
+        {
+            lex_threads = parse_count(argv[i] + 14);
+            continue;
+        }
+
+        // stay resident and compile the requests of clients (see server.c)
+        if (!strncmp(argv[i], "--server=", 9))
+        {
+            opt_server = argv[i] + 9;
+            continue;
+        }
+
+        // have the server at the socket compile the inputs
+        if (!strncmp(argv[i], "--connect=", 10))
+        {
+            opt_connect = argv[i] + 10;
+            continue;
+        }
+
+        // reuse the assembly of inputs compiled before
+        if (!strncmp(argv[i], "--cache-dir=", 12))
+        {
+            opt_cache_dir = argv[i] + 12;
+            continue;
+        }
+
+        // 0 does not limit the size of the cache
+        if (!strncmp(argv[i], "--cache-size=", 13))
+        {
+            opt_cache_size = parse_size(argv[i] + 13);
+            continue;
+        }
+
+        // recompile only the functions that changed since the last time
+        if (!strcmp(argv[i], "--incremental"))
+        {
+            opt_incremental = true;
+            continue;
+        }
+
+        if (!strcmp(argv[i], "--cache-stats"))
+        {
+            opt_cache_stats = true;
+            continue;
+        }
+
         if (argv[i][0] == '-' && argv[i][1] != '\0')
             error("unknown argument: %s", argv[i]);
 
-        input_path = argv[i];
+        jobs = realloc(jobs, sizeof(Job) * (num_jobs + 1));
+        jobs[num_jobs++] = (Job){ .input = argv[i] };
     }
 
-    if (!input_path)
+    if (num_jobs == 0 && !opt_server && !opt_cache_stats)
         error("no input files");
 }
 
+// a single input goes to -o or stdout; each input of a batch goes next to
+// it, with .s in place of its extension
+static char* output_path(char* input)
+{
+    if (num_jobs == 1)
+        return opt_o;
+
+    char* base = strrchr(input, '/');
+    char* dot = strrchr(base ? base : input, '.');
+    int len = dot ? dot - input : strlen(input);
+    return format("%.*s.s", len, input);
+}
+
 static FILE* open_file(char* path)
 {
     if (!path || strcmp(path, "-") == 0)
         return stdout;
 
     // create a new file; if the file exists, its replaced
-    FILE* out = fopen(path, "w");
+    return fopen(path, "w");
+}
+
+// compiles the input of job, or the size bytes at src read from it if given
+// on error, returns -1 and sets the messages of job
+static int compile_job(Compiler* c, Job* job, char* src, size_t size, char** out, size_t* len)
+{
+    if (opt_connect)
+    {
+        if (compile_remote(opt_connect, include_paths, num_include_paths, lex_threads, job->input, out, len) != 0)
+        {
+            job->error = *out;
+            return -1;
+        }
+        return 0;
+    }
+
+    if (opt_incremental)
+    {
+        char* path = format("%s.fns", job->output);
+        compiler_set_fn_cache(c, path);
+        free(path);
+    }
+    int status = src ? compile_source(c, job->input, src, size, out, len) : compile_file(c, job->input, out, len);
+    if (status != 0)
+    {
+        job->error = strdup(compiler_error(c));
+        return -1;
+    }
+    return 0;
+}
+
+static void run_job(Compiler* c, Job* job)
+{
+    char* out = NULL;
+    size_t len;
+
+    // the input is read once, so that the entry is keyed by the bytes that are
+    // compiled; stdin is read by the compiler, and could not be hashed beforehand
+    char* src = NULL;
+    size_t size = 0;
+    char* key = NULL;
+    FILE* in = cache && strcmp(job->input, "-") ? fopen(job->input, "r") : NULL;
+    if (in)
+    {
+        src = read_file(in, &size);
+        fclose(in);
+        key = cache_key(job->input, src, size, include_paths, num_include_paths);
+        out = cache_lookup(cache, key, &len);
+    }
+
     if (!out)
-        error("cannot open output file: %s: %s", path, strerror(errno));
-    return out;
+    {
+        // a server reads the files itself, so what it compiled is not known
+        // here, and is not stored
+        int status = compile_job(c, job, opt_connect ? NULL : src, size, &out, &len);
+        if (status == 0 && key && !opt_connect)
+            cache_store(cache, key, out, len, c->deps, c->num_deps);
+        if (status != 0)
+        {
+            free(src);
+            free(key);
+            return;
+        }
+    }
+    free(src);
+    free(key);
+
+    FILE* fp = open_file(job->output);
+    if (!fp)
+        job->error = format("cannot open output file: %s: %s\n", job->output, strerror(errno));
+    else
+    {
+        fwrite(out, 1, len, fp);
+        if (fp != stdout)
+            fclose(fp);
+    }
+    free(out);
 }
 
-int main(int argc, char** argv) 
+// each worker compiles with a compiler of its own, taking the next input
+// until none is left
+static void* run_jobs(void* arg)
+{
+    Compiler* c = new_compiler();
+    for (int i = 0; i < num_include_paths; ++i)
+        compiler_add_include_path(c, include_paths[i]);
+    c->lex_threads = lex_threads;
+    c->record_deps = cache != NULL;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&next_job_lock);
+        int i = next_job++;
+        pthread_mutex_unlock(&next_job_lock);
+        if (i >= num_jobs)
+            break;
+        run_job(c, &jobs[i]);
+    }
+
+    free_compiler(c);
+    return NULL;
+}
+
+int main(int argc, char** argv)
 {
     parse_args(argc, argv);
-    // printf("    mov $%ld, %%rax\n", get_number(tok)); // strtol converts the beginning of operations into long int and stores the rest of them in &operations)
+    if (opt_server)
+        return run_server(opt_server);
 
-    // tokenize and parse
-    Token* tok = tokenize_file(input_path);
-    Obj* prog = parse(tok);
+    // lets a build invoke the client with the arguments of the compiler
+    if (!opt_connect)
+        opt_connect = getenv("AU_CC_SERVER");
+    if (!opt_cache_dir)
+        opt_cache_dir = getenv("AU_CC_CACHE_DIR");
 
-    // traverse the AST to generate assembly code
-    FILE* out = open_file(opt_o);
-    fprintf(out, ".file 1 \"%s\"\n", input_path);
-    codegen(prog, out);
-    return 0;
-}
\ No newline at end of file
+    if (opt_cache_stats)
+    {
+        if (!opt_cache_dir)
+            error("--cache-stats needs a cache directory");
+        print_cache_stats(opt_cache_dir);
+        return 0;
+    }
+    if (opt_cache_dir)
+        cache = open_cache(opt_cache_dir, opt_cache_size);
+
+    if (num_jobs > 1)
+    {
+        if (opt_o)
+            error("cannot specify -o with multiple files");
+        for (int i = 0; i < num_jobs; ++i)
+            if (!strcmp(jobs[i].input, "-"))
+                error("cannot read stdin with multiple files");
+    }
+    for (int i = 0; i < num_jobs; ++i)
+        jobs[i].output = output_path(jobs[i].input);
+    if (opt_incremental && (!jobs[0].output || !strcmp(jobs[0].output, "-")))
+        error("--incremental needs an output file");
+    // the server keeps no sidecar cache for its clients
+    if (opt_incremental && opt_connect)
+        error("--incremental cannot be used with a compile server (--connect or AU_CC_SERVER)");
+
+    int nthreads = opt_j ? opt_j : sysconf(_SC_NPROCESSORS_ONLN);
+    if (nthreads > num_jobs)
+        nthreads = num_jobs;
+
+    if (nthreads <= 1)
+        run_jobs(NULL);
+    else
+    {
+        // files are the unit of parallelism of a batch; splitting each of
+        // them across lexer threads too would only oversubscribe the cores
+        if (!lex_threads)
+            lex_threads = 1;
+
+        pthread_t* threads = calloc(nthreads, sizeof(pthread_t));
+        for (int i = 0; i < nthreads; ++i)
+            if (pthread_create(&threads[i], NULL, run_jobs, NULL) != 0)
+                error("cannot create a compiler thread");
+        for (int i = 0; i < nthreads; ++i)
+            pthread_join(threads[i], NULL);
+        free(threads);
+    }
+
+    if (cache)
+        close_cache(cache);
+
+    int status = 0;
+    for (int i = 0; i < num_jobs; ++i)
+    {
+        if (!jobs[i].error)
+            continue;
+        fputs(jobs[i].error, stderr);
+        status = 1;
+    }
+    return status;
+}
@@ -22,8 +22,10 @@ typedef struct VarScope VarScope;
 
 struct VarScope
 {
-    VarScope* next;
-    char* name;
+    VarScope* next; // declared before in the same block scope
+    VarScope* shadowed; // binding of the same name hidden by this one
+    int sym;
+    int seq; // numbers the bindings in declaration order
     Obj* var;
     Type* type_def; // typedef int t => t is parsed as variable but contains this information
 };
@@ -33,7 +35,9 @@ typedef struct TagScope TagScope;
 struct TagScope
 {
     TagScope* next;
-    char* name;
+    TagScope* shadowed;
+    int sym;
+    int seq;
     Type* ty;
 };
 // represents a block scope
@@ -45,6 +49,7 @@ struct Scope
     // C has 2 block copes:
     // 1) varialbes
     // 2) struct tags
+    // the declarations of the block, newest first, which are undone when it is left
     VarScope* vars;
     TagScope* tags;
 };
@@ -52,18 +57,78 @@ struct Scope
 // variable attributes such as typedef or extern
 typedef struct {
     bool is_typedef;
+    bool is_static;
+    bool is_inline;
 } VarAttr;
 
-// all local variable instances created
-static Obj* locals;
+typedef struct Op Op;
 
-// all global variables
-static Obj* globals;
-
-static Scope* scope = &(Scope) {};
-
-// points to the funciton ofject the parser is currently parsing
-static Obj* current_fn;
+// the state of the parser of a compiler (see Compiler)
+struct Parser
+{
+    // the visible binding of every name, indexed by its interned symbol, so a
+    // lookup costs one array access however many declarations are visible
+    VarScope** var_bindings;
+    int var_binding_capacity;
+    TagScope** tag_bindings;
+    int tag_binding_capacity;
+    int num_bindings; // seq of the next binding
+
+    // bindings numbered from hidden_from up to hidden_to are not visible: they
+    // were declared at file scope after the definition of the deferred body
+    // being parsed, and before it was referenced
+    int hidden_from;
+    int hidden_to;
+
+    // all local variable instances created
+    Obj* locals;
+
+    // all global variables
+    Obj* globals;
+
+    Scope file_scope;
+    Scope* scope;
+
+    // the objects of a translation unit are allocated from regions and released
+    // together by reset_parser() (see region.c)
+    Region nodes;
+    Region scopes;  // Scope, VarScope and TagScope
+    Region objects; // everything else: variables, members, initializers, ...
+
+    // points to the funciton ofject the parser is currently parsing
+    Obj* current_fn;
+
+    // static functions referenced since the parser was last at file scope whose
+    // bodies have been skipped
+    Obj** pending_bodies;
+    int num_pending_bodies;
+    int pending_body_capacity;
+
+    // the stacks of the expression parser (see parse_expr()), shared by nested
+    // parses (ex: statement expressions), each using the part above where the
+    // stacks were when it started
+    Op* ops;
+    int num_ops;
+    int op_capacity;
+
+    Node** operands;
+    int num_operands;
+    int operand_capacity;
+
+    int unique_id; // of the next anonymous global
+    int literal_id; // of the next string literal of current_fn
+
+    // static functions referenced by the body being parsed, if compiling
+    // incrementally
+    Obj** refs;
+    int num_refs;
+    int ref_capacity;
+
+    // structs and unions hashed by the fingerprint being computed
+    Type** hashed_types;
+    int num_hashed_types;
+    int hashed_type_capacity;
+};
 
 static bool is_typename(Token* tok);
 static Type* declspec(Token** rest, Token* tok, VarAttr* attr);
@@ -74,81 +139,291 @@ static Node* stmt(Token** rest, Token* tok);
 static Node* expr_stmt(Token** rest, Token* tok);
 static Node* expr(Token** rest, Token* tok);
 static Node* assign(Token** rest, Token* tok);
-static Node* equality(Token** rest, Token* tok);
-static Node* relational(Token** rest, Token* tok);
-static Node* add(Token** rest, Token* tok);
-static Node* mul(Token** rest, Token* tok);
-static Node* unary(Token** rest, Token* tok);
+static Node* parse_expr(Token** rest, Token* tok, bool allow_comma);
 static Node* primary(Token** rest, Token* tok);
-static Node* postfix(Token** rest, Token* tok);
 static Type* struct_decl(Token** rest, Token* tok);
 static Type* union_decl(Token** rest, Token* tok);
 static Token* parse_typedef(Token* tok, Type* basety);
-static Node* cast(Token** rest, Token* tok);
+static char* get_ident(Token* tok);
+static int64_t const_expr(Token** rest, Token* tok);
+
+// the nesting of statements and expressions is bounded only by memory: a
+// parse about to run out of stack continues on a new segment (see stack.c)
+typedef struct
+{
+    Node* (*fn)(Token** rest, Token* tok);
+    Token** rest;
+    Token* tok;
+    Node* node;
+} DeepParse;
+
+static void run_deep_parse(void* arg)
+{
+    DeepParse* p = arg;
+    p->node = p->fn(p->rest, p->tok);
+}
+
+static Node* parse_on_new_stack(Node* (*fn)(Token**, Token*), Token** rest, Token* tok)
+{
+    DeepParse p = { fn, rest, tok };
+    call_with_stack(run_deep_parse, &p);
+    return p.node;
+}
 
 // nested scope can access external scope
 static void enter_scope(void)
 {
-    Scope* sc = calloc(1, sizeof(Scope));
-    sc->next = scope;
-    scope = sc;
+    Parser* ps = cc->parser;
+    Scope* sc = region_alloc(&ps->scopes, sizeof(Scope));
+    sc->next = ps->scope;
+    ps->scope = sc;
 }
 
 static void leave_scope(void)
 {
-    scope = scope->next;
+    Parser* ps = cc->parser;
+    for (VarScope* vs = ps->scope->vars; vs; vs = vs->next)
+        ps->var_bindings[vs->sym] = vs->shadowed;
+    for (TagScope* ts = ps->scope->tags; ts; ts = ts->next)
+        ps->tag_bindings[ts->sym] = ts->shadowed;
+    ps->scope = ps->scope->next;
+}
+
+// grows a binding table so that it can be indexed by sym
+static void* reserve_bindings(void* table, int* capacity, int sym)
+{
+    if (sym < *capacity)
+        return table;
+
+    int n = *capacity ? *capacity : 1024;
+    while (n <= sym)
+        n *= 2;
+    table = realloc(table, sizeof(void*) * n);
+    memset((void**)table + *capacity, 0, sizeof(void*) * (n - *capacity));
+    *capacity = n;
+    return table;
+}
+
+static bool is_hidden(int seq)
+{
+    Parser* ps = cc->parser;
+    return seq >= ps->hidden_from && seq < ps->hidden_to;
 }
 
 static VarScope* find_var(Token* tok)
 {
-    for (Scope* sc = scope; sc; sc = sc->next)
-    {
-        for (VarScope* vs = sc->vars; vs; vs = vs->next)
-            if (equal(tok, vs->name))
-                return vs;
-    }
-    return NULL;
+    Parser* ps = cc->parser;
+    if (tok->kind != TK_IDENT || tok->sym >= ps->var_binding_capacity)
+        return NULL;
+    VarScope* vs = ps->var_bindings[tok->sym];
+    while (vs && is_hidden(vs->seq))
+        vs = vs->shadowed;
+    return vs;
 }
 
 static Type* find_tag(Token* tok)
 {
-    for (Scope* sc = scope; sc; sc = sc->next)
+    Parser* ps = cc->parser;
+    if (tok->kind != TK_IDENT || tok->sym >= ps->tag_binding_capacity)
+        return NULL;
+    TagScope* ts = ps->tag_bindings[tok->sym];
+    while (ts && is_hidden(ts->seq))
+        ts = ts->shadowed;
+    return ts ? ts->ty : NULL;
+}
+// bytes of a node of the kind: the header and the payload of that kind
+static int node_size(NodeKind kind)
+{
+    switch (kind)
     {
-        for (TagScope* sc2 = sc->tags; sc2; sc2 = sc2->next)
-        {
-            if (equal(tok, sc2->name))
-                return sc2->ty;
-        }
+    case ND_NUM:
+        return offsetof(Node, val) + sizeof(int64_t);
+    case ND_VAR:
+        return offsetof(Node, var) + sizeof(Obj*);
+    case ND_BLOCK:
+    case ND_STMT_EXPR:
+        return offsetof(Node, body) + sizeof(Node*);
+    case ND_FUNCALL:
+        return offsetof(Node, args) + sizeof(Node*);
+    case ND_IF:
+        return offsetof(Node, els) + sizeof(Node*);
+    case ND_FOR:
+        return offsetof(Node, inc) + sizeof(Node*);
+    case ND_NEG:
+    case ND_ADDR:
+    case ND_DEREF:
+    case ND_CAST:
+    case ND_EXPR_STMT:
+    case ND_RETURN:
+        return offsetof(Node, lhs) + sizeof(Node*);
+    default:
+        return offsetof(Node, rhs) + sizeof(Node*);
     }
-    return NULL;
 }
+
+// nodes are packed together in the node region, each with only the payload
+// its kind uses
 static Node* new_node(NodeKind kind, Token* tok)
 {
-    Node* node = calloc(1, sizeof(Node));
+    Node* node = region_alloc(&cc->parser->nodes, node_size(kind));
     node->kind = kind;
     node->tok = tok;
     return node;
 }
 
+// constant folding
+// nodes are simplified as they are built, so constant subexpressions (ex:
+// sizeof(x) * 4 + 1, pointer offset scaling) reach codegen as a single ND_NUM
+
+// truncate val to the width of ty as the generated code would
+static int64_t wrap_to(Type* ty, int64_t val)
+{
+    switch (ty->size)
+    {
+    case 1:
+        return (int8_t)val;
+    case 2:
+        return (int16_t)val;
+    case 4:
+        return (int32_t)val;
+    }
+    return val;
+}
+
+static bool is_const(Node* node, int64_t val)
+{
+    return node->kind == ND_NUM && node->val == val;
+}
+
+// true if evaluating node has no side effects and cannot fault, so it may be dropped
+static bool is_pure(Node* node)
+{
+    while (node->kind == ND_NEG || node->kind == ND_CAST || node->kind == ND_MEMBER)
+        node = node->lhs;
+    return node->kind == ND_NUM || node->kind == ND_VAR;
+}
+
+static Node* new_const(int64_t val, Type* ty, Token* tok)
+{
+    Node* node = new_node(ND_NUM, tok);
+    node->val = wrap_to(ty, val);
+    node->ty = ty;
+    return node;
+}
+
+// returns a simpler node equivalent to the typed node, or node itself
+static Node* fold(Node* node)
+{
+    Node* lhs = node->lhs;
+    Node* rhs = node->rhs;
+
+    switch (node->kind)
+    {
+    case ND_NEG:
+        if (lhs->kind == ND_NUM)
+            return new_const(-(uint64_t)lhs->val, node->ty, node->tok);
+        // -(-x) => x
+        if (lhs->kind == ND_NEG)
+            return new_cast(lhs->lhs, node->ty);
+        return node;
+    case ND_CAST:
+        if (lhs->kind == ND_NUM && (is_integer(node->ty) || node->ty->kind == TY_PTR))
+            return new_const(lhs->val, node->ty, lhs->tok);
+        return node;
+    case ND_ADD:
+    case ND_SUB:
+    case ND_MUL:
+    case ND_DIV:
+    case ND_EQ:
+    case ND_NE:
+    case ND_LT:
+    case ND_LE:
+        break;
+    default:
+        return node;
+    }
+
+    if (lhs->kind == ND_NUM && rhs->kind == ND_NUM)
+    {
+        // operands are converted to a common type, so they wrap alike
+        uint64_t a = lhs->val, b = rhs->val;
+        switch (node->kind)
+        {
+        case ND_ADD:
+            return new_const(a + b, node->ty, node->tok);
+        case ND_SUB:
+            return new_const(a - b, node->ty, node->tok);
+        case ND_MUL:
+            return new_const(a * b, node->ty, node->tok);
+        case ND_DIV:
+            // division by zero is left to happen at runtime
+            if (rhs->val == 0)
+                return node;
+            if (rhs->val == -1)
+                return new_const(-a, node->ty, node->tok);
+            return new_const(lhs->val / rhs->val, node->ty, node->tok);
+        case ND_EQ:
+            return new_const(lhs->val == rhs->val, node->ty, node->tok);
+        case ND_NE:
+            return new_const(lhs->val != rhs->val, node->ty, node->tok);
+        case ND_LT:
+            return new_const(lhs->val < rhs->val, node->ty, node->tok);
+        case ND_LE:
+            return new_const(lhs->val <= rhs->val, node->ty, node->tok);
+        }
+    }
+
+    // algebraic identities; the operands already have the type of node
+    switch (node->kind)
+    {
+    case ND_ADD:
+        if (is_const(rhs, 0))
+            return lhs;
+        if (is_const(lhs, 0))
+            return rhs;
+        break;
+    case ND_SUB:
+        if (is_const(rhs, 0))
+            return lhs;
+        break;
+    case ND_MUL:
+        if (is_const(rhs, 1))
+            return lhs;
+        if (is_const(lhs, 1))
+            return rhs;
+        if ((is_const(rhs, 0) && is_pure(lhs)) || (is_const(lhs, 0) && is_pure(rhs)))
+            return new_const(0, node->ty, node->tok);
+        break;
+    case ND_DIV:
+        if (is_const(rhs, 1))
+            return lhs;
+        break;
+    }
+    return node;
+}
+
 static Node* new_binary(NodeKind kind, Node* lhs, Node* rhs, Token* tok)
 {
     Node* node = new_node(kind, tok);
     node->lhs = lhs;
     node->rhs = rhs;
-    return node;
+    add_type(node);
+    return fold(node);
 }
 
 static Node* new_unary(NodeKind kind, Node* expr, Token* tok)
 {
     Node* node = new_node(kind, tok);
     node->lhs = expr;
-    return node;
+    add_type(node);
+    return fold(node);
 }
 
 static Node* new_num(int64_t val, Token* tok)
 {
     Node* node = new_node(ND_NUM, tok);
     node->val = val;
+    add_type(node);
     return node;
 }
 
@@ -163,70 +438,137 @@ static Node* new_var_node(Obj* var, Token* tok)
 {
     Node* node = new_node(ND_VAR, tok);
     node->var = var;
+    add_type(node);
     return node;
 }
 
 Node* new_cast(Node* expr, Type* ty) {
-    add_type(expr);
-
-    Node* node = calloc(1, sizeof(Node));
-    node->kind = ND_CAST;
-    node->tok = expr->tok;
+    Node* node = new_node(ND_CAST, expr->tok);
     node->lhs = expr;
-    node->ty = copy_type(ty);
-    return node;
+    node->ty = ty;
+    return fold(node);
 }
 
-static VarScope* push_scope(char* name)
+// declares the identifier tok in the current scope, hiding any outer declaration
+static VarScope* push_scope(Token* tok)
 {
-    VarScope* vs = calloc(1, sizeof(VarScope));
-    vs->name = name;
-    vs->next = scope->vars;
-    scope->vars = vs;
+    Parser* ps = cc->parser;
+    get_ident(tok);
+    ps->var_bindings = reserve_bindings(ps->var_bindings, &ps->var_binding_capacity, tok->sym);
+
+    VarScope* vs = region_alloc(&ps->scopes, sizeof(VarScope));
+    vs->sym = tok->sym;
+    vs->seq = ps->num_bindings++;
+    vs->shadowed = ps->var_bindings[tok->sym];
+    ps->var_bindings[tok->sym] = vs;
+    vs->next = ps->scope->vars;
+    ps->scope->vars = vs;
     return vs;
 }
 
 static Obj* new_var(char* name, Type* ty)
 {
-    Obj* var = calloc(1, sizeof(Obj));
+    Obj* var = region_alloc(&cc->parser->objects, sizeof(Obj));
     var->name = name;
     var->ty = ty;
-    push_scope(name)->var = var;
     return var;
 }
 
-static Obj* new_lvar(char* name, Type* ty)
+static Obj* new_lvar(Token* tok, Type* ty)
 {
-    Obj* var = new_var(name, ty);
+    Parser* ps = cc->parser;
+    Obj* var = new_var(get_ident(tok), ty);
+    push_scope(tok)->var = var;
     var->is_local = true;
-    var->next = locals;
+    var->next = ps->locals;
     var->ty = ty;
-    locals = var;
+    ps->locals = var;
     return var;
 }
 
-static Obj* new_gvar(char* name, Type* ty)
+// anonymous globals (ex: string literals) are not declared in any scope
+static Obj* add_gvar(char* name, Type* ty)
 {
+    Parser* ps = cc->parser;
     Obj* var = new_var(name, ty);
-    var->next = globals;
-    globals = var;
+    var->next = ps->globals;
+    ps->globals = var;
     return var;
 }
 
+static Obj* new_gvar(Token* tok, Type* ty)
+{
+    Obj* var = add_gvar(get_ident(tok), ty);
+    push_scope(tok)->var = var;
+    return var;
+}
+
+// notes a use of var; a static function is emitted only if it is used
+static void reference(Obj* var)
+{
+    Parser* ps = cc->parser;
+    if (cc->fns && ps->current_fn && var->is_function && var->is_static)
+    {
+        // a body reused from the sidecar references them again (see function_body())
+        int i = 0;
+        while (i < ps->num_refs && ps->refs[i] != var)
+            ++i;
+        if (i == ps->num_refs)
+        {
+            if (ps->num_refs == ps->ref_capacity)
+            {
+                ps->ref_capacity = ps->ref_capacity ? ps->ref_capacity * 2 : 16;
+                ps->refs = realloc(ps->refs, sizeof(Obj*) * ps->ref_capacity);
+            }
+            ps->refs[ps->num_refs++] = var;
+        }
+    }
+
+    if (!var->is_function || var->is_referenced)
+        return;
+    var->is_referenced = true;
+
+    if (!var->is_static || !var->body_tok || var->body)
+        return;
+    if (ps->num_pending_bodies == ps->pending_body_capacity)
+    {
+        ps->pending_body_capacity = ps->pending_body_capacity ? ps->pending_body_capacity * 2 : 64;
+        ps->pending_bodies = realloc(ps->pending_bodies, sizeof(Obj*) * ps->pending_body_capacity);
+    }
+    ps->pending_bodies[ps->num_pending_bodies++] = var;
+}
+
 static char* new_unique_name(void)
 {
-    static int id = 0;
-    return format(".L..%d", id++);
+    Parser* ps = cc->parser;
+    char* name = region_alloc(&ps->objects, 32);
+    snprintf(name, 32, ".L..%d", ps->unique_id++);
+    return name;
 }
 
 static Obj* new_anon_gvar(Type* ty)
 {
-    return new_gvar(new_unique_name(), ty);
+    return add_gvar(new_unique_name(), ty);
 }
 
+// the string literals of a function are named after it and emitted with it,
+// so that its assembly does not depend on the rest of the file
 static Obj* new_string_literal(char* p, Type* ty)
 {
-    Obj* var = new_anon_gvar(ty);
+    Parser* ps = cc->parser;
+    Obj* fn = ps->current_fn;
+    Obj* var;
+    if (fn)
+    {
+        int size = strlen(fn->name) + 32;
+        char* name = region_alloc(&ps->objects, size);
+        snprintf(name, size, ".L..%s.%d", fn->name, ps->literal_id++);
+        var = new_var(name, ty);
+        var->next = fn->literals;
+        fn->literals = var;
+    }
+    else
+        var = new_anon_gvar(ty);
     var->init_data = p;
     return var;
 }
@@ -236,7 +578,7 @@ get_ident(Token* tok)
 {
     if (tok->kind != TK_IDENT)
         error_tok(tok, "expected an identifier");
-    return strndup(tok->loc, tok->len);
+    return symbol_name(tok->sym);
 }
 
 static Type* find_typedef(Token* tok) {
@@ -248,20 +590,20 @@ static Type* find_typedef(Token* tok) {
     return NULL;
 }
 
-static int get_number(Token* tok)
-{
-    if (tok->kind != TK_NUM)
-        error_tok(tok, "expected a number");
-    return tok->val;
-}
-
 static void push_tag_scope(Token* tok, Type* ty)
 {
-    TagScope* sc = calloc(1, sizeof(TagScope));
-    sc->name = strndup(tok->loc, tok->len);
+    Parser* ps = cc->parser;
+    get_ident(tok);
+    ps->tag_bindings = reserve_bindings(ps->tag_bindings, &ps->tag_binding_capacity, tok->sym);
+
+    TagScope* sc = region_alloc(&ps->scopes, sizeof(TagScope));
+    sc->sym = tok->sym;
+    sc->seq = ps->num_bindings++;
     sc->ty = ty;
-    sc->next = scope->tags;
-    scope->tags = sc;
+    sc->shadowed = ps->tag_bindings[tok->sym];
+    ps->tag_bindings[tok->sym] = sc;
+    sc->next = ps->scope->tags;
+    ps->scope->tags = sc;
 }
 
 // declspec (type) = "void" | "char" | "short" | "int" | "long" | struct-decl | union-decl
@@ -281,49 +623,56 @@ static Type* declspec(Token** rest, Token* tok, VarAttr* attr)
     int counter = 0;
 
     while (is_typename(tok)) {
-        // handles "typedef" keyword
-        if (equal(tok, "typedef")) {
+        // handles "typedef", "static" and "inline" keywords
+        if (equal(tok, KW_TYPEDEF) || equal(tok, KW_STATIC) || equal(tok, KW_INLINE)) {
             if (!attr)
                 error_tok(tok, "storage class specifier is not allowed in this context");
-            attr->is_typedef = true;
-            tok = tok->next;
+            if (equal(tok, KW_TYPEDEF))
+                attr->is_typedef = true;
+            else if (equal(tok, KW_STATIC))
+                attr->is_static = true;
+            else
+                attr->is_inline = true;
+            if (attr->is_typedef && attr->is_static)
+                error_tok(tok, "typedef and static may not be used together");
+            tok = tok + 1;
             continue;
         }
 
         // handles user defined types
         Type* second_ty = find_typedef(tok);    //declaration of typedef will be skipped?
-        if (equal(tok, "struct") || equal(tok, "union") || second_ty) {
+        if (equal(tok, KW_STRUCT) || equal(tok, KW_UNION) || second_ty) {
             if (counter)
                 break;
 
-            if (equal(tok, "struct")) {
-                ty = struct_decl(&tok, tok->next);
+            if (equal(tok, KW_STRUCT)) {
+                ty = struct_decl(&tok, tok + 1);
             }
-            else if (equal(tok, "union")) {
-                ty = union_decl(&tok, tok->next);
+            else if (equal(tok, KW_UNION)) {
+                ty = union_decl(&tok, tok + 1);
             }
             else {
                 ty = second_ty;
-                tok = tok->next;
+                tok = tok + 1;
             }
             counter += OTHER;
             continue;
         }
 
         // handles built-int type
-        if (equal(tok, "void")) {
+        if (equal(tok, KW_VOID)) {
             counter += VOID;
         }
-        else if (equal(tok, "char")) {
+        else if (equal(tok, KW_CHAR)) {
             counter += CHAR;
         }
-        else if (equal(tok, "short")) {
+        else if (equal(tok, KW_SHORT)) {
             counter += SHORT;
         }
-        else if (equal(tok, "int")) {
+        else if (equal(tok, KW_INT)) {
             counter += INT;
         }
-        else if (equal(tok, "long")) {
+        else if (equal(tok, KW_LONG)) {
             counter += LONG;
         }
         else {
@@ -352,7 +701,7 @@ static Type* declspec(Token** rest, Token* tok, VarAttr* attr)
         default:
             error_tok(tok, "invalide type");
         }
-        tok = tok->next;
+        tok = tok + 1;
     }
     *rest = tok;
     return ty;
@@ -364,11 +713,11 @@ static Type* func_params(Token** rest, Token* tok, Type* ty)
     Type head = {};
     Type* cur = &head;
 
-    while (!equal(tok, ")"))
+    while (!equal(tok, ')'))
     {
         if (cur != &head)
         {
-            tok = skip(tok, ",");
+            tok = skip(tok, ',');
         }
         Type* basety = declspec(&tok, tok, NULL);   //cannot declare typedef in function parameter thus null
         Type* ty = declarator(&tok, tok, basety);
@@ -377,7 +726,7 @@ static Type* func_params(Token** rest, Token* tok, Type* ty)
 
     ty = func_type(ty);
     ty->params = head.next;
-    *rest = tok->next;
+    *rest = tok + 1;
     return ty;
 }
 
@@ -385,13 +734,15 @@ static Type* func_params(Token** rest, Token* tok, Type* ty)
 //              | "[" num "]" type_suffix
 //              | ε
 static Type* type_suffix(Token** rest, Token* tok, Type* ty) {
-    if (equal(tok, "("))
-        return func_params(rest, tok->next, ty);
+    if (equal(tok, '('))
+        return func_params(rest, tok + 1, ty);
 
-    if (equal(tok, "["))
+    if (equal(tok, '['))
     {
-        int sz = get_number(tok->next);
-        tok = skip(tok->next->next, "]");
+        int sz = const_expr(&tok, tok + 1);
+        if (sz < 0)
+            error_tok(tok, "array size is negative");
+        tok = skip(tok, ']');
         ty = type_suffix(rest, tok, ty);
         return array_of(ty, sz);
     }
@@ -400,26 +751,96 @@ static Type* type_suffix(Token** rest, Token* tok, Type* ty) {
     return ty;
 }
 
+// lookahead without building types
+// speculative parses only need to know where a construct ends or which kind of
+// type a declarator derives, which the tokens alone tell
+
+// returns the token following the ( ), [ ] or { } group starting at tok
+static Token* skip_brackets(Token* tok)
+{
+    Token* start = tok;
+    int depth = 0;
+    do
+    {
+        if (tok->kind == TK_EOF)
+            error_tok(start, "unclosed '%s'", token_id_str(start->id));
+        if (equal(tok, '(') || equal(tok, '[') || equal(tok, '{'))
+            ++depth;
+        else if (equal(tok, ')') || equal(tok, ']') || equal(tok, '}'))
+            --depth;
+        tok = tok + 1;
+    } while (depth > 0);
+    return tok;
+}
+
+// skips a type-suffix and returns the kind of type it derives, or -1 if empty
+static int scan_type_suffix(Token** rest, Token* tok)
+{
+    int kind = -1;
+    if (equal(tok, '('))
+    {
+        kind = TY_FUNC;
+        tok = skip_brackets(tok);
+    }
+    else if (equal(tok, '['))
+    {
+        kind = TY_ARRAY;
+        while (equal(tok, '['))
+            tok = skip_brackets(tok);
+    }
+    *rest = tok;
+    return kind;
+}
+
+// skips a declarator and returns the kind of the type it declares, or -1 if
+// that is the base type itself; see declarator() for how the parts combine
+static int scan_declarator(Token** rest, Token* tok)
+{
+    bool is_pointer = false;
+    while (consume(&tok, tok, '*'))
+        is_pointer = true;
+
+    int kind;
+    if (equal(tok, '('))
+    {
+        int inner = scan_declarator(&tok, tok + 1);
+        tok = skip(tok, ')');
+        kind = scan_type_suffix(rest, tok);
+        if (inner >= 0)
+            return inner;
+    }
+    else
+    {
+        if (tok->kind != TK_IDENT)
+            error_tok(tok, "expected a variable name");
+        kind = scan_type_suffix(rest, tok + 1);
+    }
+
+    if (kind >= 0)
+        return kind;
+    return is_pointer ? TY_PTR : -1;
+}
+
 // declarator = "*"* ("(" ident ")" | "(" declarator ")" | ident) type-suffix
 static Type* declarator(Token** rest, Token* tok, Type* ty)
 {
-    while (consume(&tok, tok, "*")) {
+    while (consume(&tok, tok, '*')) {
         ty = pointer_to(ty);
     }
 
-    if (equal(tok, "("))
+    if (equal(tok, '('))
     {
+        // the suffix after the parentheses applies first, so the inner
+        // declarator is skipped and parsed once the suffix is known
         Token* start = tok;
-        Type dummy = {};
-        declarator(&tok, start->next, &dummy);
-        tok = skip(tok, ")");
+        tok = skip_brackets(start);
         ty = type_suffix(rest, tok, ty);
-        return declarator(&tok, start->next, ty);
+        return declarator(&tok, start + 1, ty);
     }
     if (tok->kind != TK_IDENT)
         error_tok(tok, "expected a variable name");
 
-    ty = type_suffix(rest, tok->next, ty);
+    ty = type_suffix(rest, tok + 1, ty);
     ty->name = tok;
     return ty;
 }
@@ -429,21 +850,19 @@ static Type* declarator(Token** rest, Token* tok, Type* ty)
 // int * | int *[3] => array of 3 pointers to int | int (*) [5] => pointer to array of 5 int | int *() => function with no parameter and returning a pointer to int
 // used for argument to sizeof and cast
 static Type* abstract_declarator(Token** rest, Token* tok, Type* ty) {
-    while (equal(tok, "*")) {
+    while (equal(tok, '*')) {
         ty = pointer_to(ty);
-        tok = tok->next;
+        tok = tok + 1;
     }
 
-    if (equal(tok, "(")) {
+    if (equal(tok, '(')) {
         // set the base point
         Token* start = tok;
-        Type dummy = {};
         // skip the content inside () as this has the higher priority and will be used as a base point at the end
-        abstract_declarator(&tok, start->next, &dummy);
-        tok = skip(tok, ")");
+        tok = skip_brackets(start);
         ty = type_suffix(rest, tok, ty);
         // content () will the base point to the type declared outside
-        return abstract_declarator(&tok, start->next, ty);
+        return abstract_declarator(&tok, start + 1, ty);
     }
     return type_suffix(rest, tok, ty);
 }
@@ -460,11 +879,11 @@ static Node* declaration(Token** rest, Token* tok, Type* basety)
     Node* cur = &head;
     int i = 0;
 
-    while (!equal(tok, ";"))
+    while (!equal(tok, ';'))
     {
         if (i++ > 0)
         {
-            tok = skip(tok, ",");
+            tok = skip(tok, ',');
         }
 
         Type* ty = declarator(&tok, tok, basety);
@@ -472,34 +891,38 @@ static Node* declaration(Token** rest, Token* tok, Type* basety)
             error_tok(tok, "variable declared as void");
         }
 
-        Obj* var = new_lvar(get_ident(ty->name), ty);
+        Obj* var = new_lvar(ty->name, ty);
 
-        if (!equal(tok, "="))
+        if (!equal(tok, '='))
             continue;
 
         Node* lhs = new_var_node(var, ty->name);
-        Node* rhs = assign(&tok, tok->next);
+        Node* rhs = assign(&tok, tok + 1);
         Node* node = new_binary(ND_ASSIGN, lhs, rhs, tok);
         cur = cur->next = new_unary(ND_EXPR_STMT, node, tok);
     }
 
     Node* node = new_node(ND_BLOCK, tok);
     node->body = head.next;
-    *rest = tok->next;
+    *rest = tok + 1;
     return node;
 }
 
 // return true if a give token represents a type | typedef
 static bool is_typename(Token* tok)
 {
-    static char* kw[] = {
-        "void", "char", "short", "int", "long", "struct", "union", "typedef"
-    };
-
-    for (int i = 0; i < sizeof(kw) / sizeof(*kw); ++i) {
-        if (equal(tok, kw[i])) {
-            return true;
-        }
+    switch (tok->id) {
+    case KW_VOID:
+    case KW_CHAR:
+    case KW_SHORT:
+    case KW_INT:
+    case KW_LONG:
+    case KW_STRUCT:
+    case KW_UNION:
+    case KW_TYPEDEF:
+    case KW_STATIC:
+    case KW_INLINE:
+        return true;
     }
     return find_typedef(tok);
 }
@@ -509,64 +932,66 @@ static bool is_typename(Token* tok)
 //     || "for" "(" expr-stmt ";" expr? ";" expr? ")" stmt
 static Node* stmt(Token** rest, Token* tok)
 {
-    if (equal(tok, "return"))
+    if (stack_is_low())
+        return parse_on_new_stack(stmt, rest, tok);
+
+    if (equal(tok, KW_RETURN))
     {
         Node* node = new_node(ND_RETURN, tok);
-        Node* exp = expr(&tok, tok->next);
-        *rest = skip(tok, ";");
+        Node* exp = expr(&tok, tok + 1);
+        *rest = skip(tok, ';');
 
-        add_type(exp);
-        node->lhs = new_cast(exp, current_fn->ty->return_ty);
+        node->lhs = new_cast(exp, cc->parser->current_fn->ty->return_ty);
         return node;
     }
-    if (equal(tok, "if"))
+    if (equal(tok, KW_IF))
     {
         Node* node = new_node(ND_IF, tok);
-        tok = skip(tok->next, "(");
+        tok = skip(tok + 1, '(');
         node->cond = expr(&tok, tok);
-        tok = skip(tok, ")");
+        tok = skip(tok, ')');
         node->then = stmt(&tok, tok);
-        if (equal(tok, "else"))
+        if (equal(tok, KW_ELSE))
         {
-            node->els = stmt(&tok, tok->next);
+            node->els = stmt(&tok, tok + 1);
         }
         *rest = tok;
         return node;
     }
-    if (equal(tok, "for"))
+    if (equal(tok, KW_FOR))
     {
         Node* node = new_node(ND_FOR, tok);
-        tok = skip(tok->next, "(");
+        tok = skip(tok + 1, '(');
 
         node->init = expr_stmt(&tok, tok); // expr with ";" at the end
 
-        if (!equal(tok, ";"))
+        if (!equal(tok, ';'))
         {
             node->cond = expr(&tok, tok);
         }
-        tok = skip(tok, ";");
+        tok = skip(tok, ';');
 
-        if (!equal(tok, ")"))
+        if (!equal(tok, ')'))
         {
             node->inc = expr(&tok, tok);
         }
-        tok = skip(tok, ")");
+        tok = skip(tok, ')');
 
         node->then = stmt(rest, tok);
         return node;
     }
-    if (equal(tok, "while"))
+    if (equal(tok, KW_WHILE))
     {
         Node* node = new_node(ND_FOR, tok);
-        tok = skip(tok->next, "(");
+        tok = skip(tok + 1, '(');
         node->cond = expr(&tok, tok);
-        tok = skip(tok, ")");
+        tok = skip(tok, ')');
         node->then = stmt(rest, tok);
         return node;
     }
 
-    if (equal(tok, "{"))
-        return compound_stmt(rest, tok->next);
+    if (equal(tok, '{'))
+        return compound_stmt(rest, tok + 1);
     return expr_stmt(rest, tok);
 }
 
@@ -579,7 +1004,7 @@ static Node* compound_stmt(Token** rest, Token* tok)
 
     enter_scope();
 
-    while (!equal(tok, "}"))
+    while (!equal(tok, '}'))
     {
         // declaration
         if (is_typename(tok)) {
@@ -590,104 +1015,48 @@ static Node* compound_stmt(Token** rest, Token* tok)
                 tok = parse_typedef(tok, basety);
                 continue;
             }
+            if (attr.is_static)
+                error_tok(tok, "static local variables are not supported");
             cur = cur->next = declaration(&tok, tok, basety);
         }
         else
             cur = cur->next = stmt(&tok, tok);
-        add_type(cur);
     }
 
     leave_scope();
 
     node->body = head.next;
-    *rest = tok->next;
+    *rest = tok + 1;
     return node;
 }
 
 // expr-stmt = expr ? ";"
 static Node* expr_stmt(Token** rest, Token* tok)
 {
-    if (equal(tok, ";"))
+    if (equal(tok, ';'))
     {
-        *rest = tok->next;
+        *rest = tok + 1;
         return new_node(ND_BLOCK, tok);
     }
     Node* node = new_node(ND_EXPR_STMT, tok);
     node->lhs = expr(&tok, tok);
-    *rest = skip(tok, ";");
+    *rest = skip(tok, ';');
     return node;
 }
-// expr = assign ("," expr) ?
+// expr = assign ("," assign)*
 static Node* expr(Token** rest, Token* tok)
 {
-    Node* node = assign(&tok, tok);
-
-    if (equal(tok, ","))
-        return new_binary(ND_COMMA, node, expr(rest, tok->next), tok);
-
-    *rest = tok;
-    return node;
+    if (stack_is_low())
+        return parse_on_new_stack(expr, rest, tok);
+    return parse_expr(rest, tok, true);
 }
 
+// assign = binary ("=" assign)?
 static Node* assign(Token** rest, Token* tok)
 {
-    Node* node = equality(&tok, tok);
-
-    if (equal(tok, "="))
-    {
-        node = new_binary(ND_ASSIGN, node, assign(&tok, tok->next), tok);
-    }
-    *rest = tok;
-    return node;
-}
-
-static Node* equality(Token** rest, Token* tok)
-{
-    Node* node = relational(&tok, tok);
-
-    while (true)
-    {
-        Token* start = tok;
-        if (equal(tok, "=="))
-        {
-            node = new_binary(ND_EQ, node, relational(&tok, tok->next), start);
-            continue;
-        }
-        else if (equal(tok, "!="))
-        {
-            node = new_binary(ND_NE, node, relational(&tok, tok->next), start);
-            continue;
-        }
-        *rest = tok;
-        return node;
-    }
-}
-
-static Node* relational(Token** rest, Token* tok)
-{
-    Node* node = add(&tok, tok);
-    while (true)
-    {
-        Token* start = tok;
-        if (equal(tok, "<"))
-        {
-            node = new_binary(ND_LT, node, add(&tok, tok->next), start);
-        }
-        else if (equal(tok, "<="))
-        {
-            node = new_binary(ND_LE, node, add(&tok, tok->next), start);
-        }
-        else if (equal(tok, ">"))
-        {
-            node = new_binary(ND_LT, add(&tok, tok->next), node, start);
-        }
-        else if (equal(tok, ">="))
-        {
-            node = new_binary(ND_LE, add(&tok, tok->next), node, start);
-        }
-        *rest = tok;
-        return node;
-    }
+    if (stack_is_low())
+        return parse_on_new_stack(assign, rest, tok);
+    return parse_expr(rest, tok, false);
 }
 
 // pointer arithmatic
@@ -696,9 +1065,6 @@ static Node* relational(Token** rest, Token* tok)
 // The following function accomodates the above distinction
 static Node* new_add(Node* lhs, Node* rhs, Token* tok)
 {
-    add_type(lhs);
-    add_type(rhs);
-
     if (is_integer(lhs->ty) && is_integer(rhs->ty))
     {
         return new_binary(ND_ADD, lhs, rhs, tok);
@@ -723,9 +1089,6 @@ static Node* new_add(Node* lhs, Node* rhs, Token* tok)
 
 static Node* new_sub(Node* lhs, Node* rhs, Token* tok)
 {
-    add_type(lhs);
-    add_type(rhs);
-
     if (is_integer(lhs->ty) && is_integer(rhs->ty))
         return new_binary(ND_SUB, lhs, rhs, tok);
 
@@ -733,8 +1096,9 @@ static Node* new_sub(Node* lhs, Node* rhs, Token* tok)
     if (lhs->ty->base && is_integer(rhs->ty))
     {
         rhs = new_binary(ND_MUL, rhs, new_long(lhs->ty->base->size, tok), tok);
-        add_type(rhs);
-        Node* node = new_binary(ND_SUB, lhs, rhs, tok);
+        Node* node = new_node(ND_SUB, tok);
+        node->lhs = lhs;
+        node->rhs = rhs;
         node->ty = lhs->ty;
         return node;
     }
@@ -742,7 +1106,9 @@ static Node* new_sub(Node* lhs, Node* rhs, Token* tok)
     // ptr - ptr
     if (lhs->ty->base && rhs->ty->base)
     {
-        Node* node = new_binary(ND_SUB, lhs, rhs, tok);
+        Node* node = new_node(ND_SUB, tok);
+        node->lhs = lhs;
+        node->rhs = rhs;
         node->ty = ty_int;
         return new_binary(ND_DIV, node, new_num(lhs->ty->base->size, tok), tok);
     }
@@ -750,112 +1116,113 @@ static Node* new_sub(Node* lhs, Node* rhs, Token* tok)
     error_tok(tok, "invalid operands");
 }
 
-static Node* add(Token** rest, Token* tok)
+// binary operators, from the loosest:
+//   "," | "=" | "==" "!=" | "<" "<=" ">" ">=" | "+" "-" | "*" "/"
+// returns the precedence of the operator tok, or 0 if it is none
+static int binary_prec(Token* tok)
 {
-    Node* node = mul(&tok, tok);
-    while (true)
+    switch (tok->id)
     {
-        Token* start = tok;
-        if (equal(tok, "+"))
-        {
-            node = new_add(node, mul(&tok, tok->next), start);
-            continue;
-        }
-        else if (equal(tok, "-"))
-        {
-            node = new_sub(node, mul(&tok, tok->next), start);
-            continue;
-        }
-        *rest = tok;
-        return node;
-    }
-}
-
-// mul = cast ("*" cast | "/" cast)*
-static Node* mul(Token** rest, Token* tok)
-{
-    Node* node = cast(&tok, tok);
-    while (true)
-    {
-        Token* start = tok;
-        if (equal(tok, "*"))
-        {
-            node = new_binary(ND_MUL, node, cast(&tok, tok->next), start);
-            continue;
-        }
-        else if (equal(tok, "/"))
-        {
-            node = new_binary(ND_DIV, node, cast(&tok, tok->next), start);
-            continue;
-        }
-        *rest = tok;
-        return node;
-    }
-}
-
-// cast = "(" type-name ")" cast | unary
-static Node* cast(Token** rest, Token* tok) {
-    if (equal(tok, "(") && is_typename(tok->next)) {
-        Token* start = tok;
-        Type* ty = typename(&tok, tok->next);
-        tok = skip(tok, ")");
-        Node* node = new_cast(cast(rest, tok), ty);
-        node->tok = start;
-        return node;
+    case ',':
+        return 1;
+    case '=':
+        return 2;
+    case PU_EQ:
+    case PU_NE:
+        return 3;
+    case '<':
+    case PU_LE:
+    case '>':
+    case PU_GE:
+        return 4;
+    case '+':
+    case '-':
+        return 5;
+    case '*':
+    case '/':
+        return 6;
     }
-    return unary(rest, tok);
+    return 0;
 }
 
-// unary = ("+" | "-" | "*" | "&") unary
-//        | postfix
-static Node* unary(Token** rest, Token* tok)
+static Node* new_binary_op(Token* op, Node* lhs, Node* rhs)
 {
-    if (equal(tok, "+"))
-    {
-        return cast(rest, tok->next);
-    }
-    else if (equal(tok, "-"))
-    {
-        return new_unary(ND_NEG, cast(rest, tok->next), tok);
-    }
-    else if (equal(tok, "*"))
-    {
-        return new_unary(ND_DEREF, cast(rest, tok->next), tok);
-    }
-    else if (equal(tok, "&"))
+    switch (op->id)
     {
-        return new_unary(ND_ADDR, cast(rest, tok->next), tok);
+    case ',':
+        return new_binary(ND_COMMA, lhs, rhs, op);
+    case '=':
+        return new_binary(ND_ASSIGN, lhs, rhs, op);
+    case PU_EQ:
+        return new_binary(ND_EQ, lhs, rhs, op);
+    case PU_NE:
+        return new_binary(ND_NE, lhs, rhs, op);
+    case '<':
+        return new_binary(ND_LT, lhs, rhs, op);
+    case PU_LE:
+        return new_binary(ND_LE, lhs, rhs, op);
+    case '>':
+        return new_binary(ND_LT, rhs, lhs, op);
+    case PU_GE:
+        return new_binary(ND_LE, rhs, lhs, op);
+    case '+':
+        return new_add(lhs, rhs, op);
+    case '-':
+        return new_sub(lhs, rhs, op);
+    case '*':
+        return new_binary(ND_MUL, lhs, rhs, op);
     }
-    return postfix(rest, tok);
+    return new_binary(ND_DIV, lhs, rhs, op);
 }
 
 // struct-member = (declspec declarator ("," declarator)* ";")*
 static void struct_members(Token** rest, Token* tok, Type* ty)
 {
+    Parser* ps = cc->parser;
     Member head = {};
     Member* cur = &head;
+    int num_members = 0;
 
-    while (!equal(tok, "}"))
+    while (!equal(tok, '}'))
     {
         Type* basety = declspec(&tok, tok, NULL);
         int i = 0;
 
-        while (!consume(&tok, tok, ";"))
+        while (!consume(&tok, tok, ';'))
         {
             if (i++)
             {
-                tok = skip(tok, ",");
+                tok = skip(tok, ',');
             }
 
-            Member* mem = calloc(1, sizeof(Member));
+            Member* mem = region_alloc(&ps->objects, sizeof(Member));
             mem->ty = declarator(&tok, tok, basety);
-            mem->name = mem->ty->name;
+            mem->name = get_ident(mem->ty->name);
+            mem->sym = mem->ty->name->sym;
             cur = cur->next = mem;
+            ++num_members;
         }
     }
 
-    *rest = tok->next;
+    *rest = tok + 1;
     ty->members = head.next;
+
+    // index the members by symbol with open addressing at a load factor of at
+    // most 1/2; symbols are sequential, so the low bits spread them well
+    int capacity = 4;
+    while (capacity < num_members * 2)
+        capacity *= 2;
+    ty->member_index = region_alloc(&ps->objects, sizeof(Member*) * capacity);
+    ty->member_index_capacity = capacity;
+    for (Member* mem = ty->members; mem; mem = mem->next)
+    {
+        int i = mem->sym & (capacity - 1);
+        while (ty->member_index[i] && ty->member_index[i]->sym != mem->sym)
+            i = (i + 1) & (capacity - 1);
+        if (ty->member_index[i])
+            error_tok(mem->ty->name, "duplicate member");
+        ty->member_index[i] = mem;
+    }
 }
 
 // struct-union-decl = ident? ("{" struct-members)?
@@ -866,10 +1233,10 @@ static Type* struct_union_decl(Token** rest, Token* tok)
     if (tok->kind == TK_IDENT)
     {
         tag = tok;
-        tok = tok->next;
+        tok = tok + 1;
     }
 
-    if (tag && !equal(tok, "{"))
+    if (tag && !equal(tok, '{'))
     {
         Type* ty = find_tag(tag);
         if (!ty)
@@ -879,9 +1246,8 @@ static Type* struct_union_decl(Token** rest, Token* tok)
     }
 
     // construct a struct object
-    Type* ty = calloc(1, sizeof(Type));
-    ty->kind = TY_STRUCT;
-    struct_members(rest, tok->next, ty);
+    Type* ty = struct_type();
+    struct_members(rest, tok + 1, ty);
     ty->align = 1;
 
     // register the struct type if a name was given
@@ -917,7 +1283,7 @@ static Type* union_decl(Token** rest, Token* tok)
     ty->kind = TY_UNION;
 
     // union size and alignement are based on the largest member
-    // struct members are all initialized to 0 using calloc
+    // struct members are all initialized to 0 by the region
     for (Member* mem = ty->members; mem; mem = mem->next)
     {
         if (ty->align < mem->ty->align)
@@ -931,157 +1297,345 @@ static Type* union_decl(Token** rest, Token* tok)
 
 static Member* get_struct_member(Type* ty, Token* tok)
 {
-    for (Member* mem = ty->members; mem; mem = mem->next)
-        if (mem->name->len == tok->len && !strncmp(mem->name->loc, tok->loc, tok->len))
-            return mem;
+    if (tok->kind == TK_IDENT)
+    {
+        int mask = ty->member_index_capacity - 1;
+        for (int i = tok->sym & mask; ty->member_index[i]; i = (i + 1) & mask)
+            if (ty->member_index[i]->sym == tok->sym)
+                return ty->member_index[i];
+    }
     error_tok(tok, "no such member");
 }
 
 // create node for the struct member (tok); struct and its member "type" have been created in lhs during declspec
 static Node* struct_ref(Node* lhs, Token* tok)
 {
-    add_type(lhs);
     if (lhs->ty->kind != TY_STRUCT && lhs->ty->kind != TY_UNION)
         error_tok(lhs->tok, "not a struct or a union");
 
-    Node* node = new_unary(ND_MEMBER, lhs, tok);
+    Node* node = new_node(ND_MEMBER, tok);
+    node->lhs = lhs;
     node->member = get_struct_member(lhs->ty, tok);
+    add_type(node);
     return node;
 }
 
-// postfix = primary( "[" expr "]" | "." ident | "->" ident)*
-static Node* postfix(Token** rest, Token* tok)
+// expressions
+// parsed by operator precedence with explicit stacks rather than by one
+// recursive function per precedence level: "(", prefix operators, subscripts
+// and calls push an entry which is reduced once its operand is complete, so
+// the nesting of an expression is bounded only by memory
+//
+// expr     = assign ("," assign)*
+// assign   = binary ("=" assign)?
+// binary   = cast (binary-op cast)*
+// cast     = "(" type-name ")" cast | unary
+// unary    = ("+" | "-" | "*" | "&" | "sizeof") cast | postfix
+// postfix  = primary ("[" expr "]" | "." ident | "->" ident)*
+//          | ident "(" (assign ("," assign)*)? ")"
+//          | "(" expr ")"
+typedef enum
+{
+    OP_PAREN,     // "("
+    OP_SUBSCRIPT, // "[" following its array operand
+    OP_CALL,      // "(" following a function name
+    OP_PREFIX,    // unary operator or cast
+    OP_BINARY,
+} OpKind;
+
+struct Op
 {
-    Node* node = primary(&tok, tok);
+    OpKind kind;
+    int prec;    // OP_BINARY
+    Token* tok;  // the operator; the function name of OP_CALL
+    Type* ty;    // target type of a cast
+    int operand; // OP_CALL: index of the first argument on the operand stack
+};
 
-    for (;;)
+static void push_op(OpKind kind, int prec, Token* tok, Type* ty)
+{
+    Parser* ps = cc->parser;
+    if (ps->num_ops == ps->op_capacity)
     {
-        if (equal(tok, "["))
-        {
-            // x[y] => *(x + y);
-            Token* start = tok;
-            Node* idx = expr(&tok, tok->next);
-            tok = skip(tok, "]");
-            node = new_unary(ND_DEREF, new_add(node, idx, start), start);
-            continue;
-        }
-        if (equal(tok, "."))
-        {
-            node = struct_ref(node, tok->next);
-            tok = tok->next->next;
-            continue;
-        }
-        if (equal(tok, "->"))
-        {
-            // x->y is tantamount to (*x).y
-            node = new_unary(ND_DEREF, node, tok);
-            node = struct_ref(node, tok->next);
-            tok = tok->next->next;
-            continue;
-        }
-        *rest = tok;
-        return node;
+        ps->op_capacity = ps->op_capacity ? ps->op_capacity * 2 : 256;
+        ps->ops = realloc(ps->ops, sizeof(Op) * ps->op_capacity);
     }
+    ps->ops[ps->num_ops++] = (Op) { kind, prec, tok, ty, ps->num_operands };
 }
 
-// when a function is called (this is defined somewhere else)
-// funcall = ident "(" (assign ("," assign)*)? ")"
-static Node* funcall(Token** rest, Token* tok)
+static void push_operand(Node* node)
 {
-    Token* start = tok;
-    tok = tok->next->next;
+    Parser* ps = cc->parser;
+    if (ps->num_operands == ps->operand_capacity)
+    {
+        ps->operand_capacity = ps->operand_capacity ? ps->operand_capacity * 2 : 256;
+        ps->operands = realloc(ps->operands, sizeof(Node*) * ps->operand_capacity);
+    }
+    ps->operands[ps->num_operands++] = node;
+}
+
+// applies the prefix or binary operator on top of the stack to its operands
+static void reduce(void)
+{
+    Parser* ps = cc->parser;
+    Op* op = &ps->ops[--ps->num_ops];
+    Node* node = ps->operands[--ps->num_operands];
+
+    if (op->kind == OP_BINARY)
+    {
+        Node* lhs = ps->operands[--ps->num_operands];
+        push_operand(new_binary_op(op->tok, lhs, node));
+        return;
+    }
+
+    if (op->ty)
+    {
+        node = new_cast(node, op->ty);
+        node->tok = op->tok;
+    }
+    else if (equal(op->tok, '-'))
+        node = new_unary(ND_NEG, node, op->tok);
+    else if (equal(op->tok, '*'))
+        node = new_unary(ND_DEREF, node, op->tok);
+    else if (equal(op->tok, '&'))
+        node = new_unary(ND_ADDR, node, op->tok);
+    else
+        node = new_num(node->ty->size, op->tok);
+    push_operand(node);
+}
+
+// reduces the operators above base that bind at least as tightly as prec
+// (more tightly if right_assoc); stops at brackets
+static void reduce_to(int base, int prec, bool right_assoc)
+{
+    Parser* ps = cc->parser;
+    while (ps->num_ops > base)
+    {
+        Op* op = &ps->ops[ps->num_ops - 1];
+        if (op->kind == OP_BINARY && (op->prec < prec || (right_assoc && op->prec == prec)))
+            return;
+        if (op->kind != OP_BINARY && op->kind != OP_PREFIX)
+            return;
+        reduce();
+    }
+}
 
-    VarScope* sc = find_var(start);
+// when a function is called (this is defined somewhere else)
+// pushes the call of the function named tok and returns true if it has arguments
+static bool open_call(Token* tok)
+{
+    VarScope* sc = find_var(tok);
     if (!sc) {
-        error_tok(start, "implicit declaration of a function");
+        error_tok(tok, "implicit declaration of a function");
     }
     if (!sc->var || sc->var->ty->kind != TY_FUNC) {
-        error_tok(start, "not a function");
+        error_tok(tok, "not a function");
     }
 
-    Type* ty = sc->var->ty->return_ty;
+    reference(sc->var);
+    push_op(OP_CALL, 0, tok, sc->var->ty->return_ty);
+    return !equal(tok + 2, ')');
+}
+
+// pops the call on top of the stack, whose arguments are complete
+static void close_call(void)
+{
+    Parser* ps = cc->parser;
+    Op* op = &ps->ops[--ps->num_ops];
     Node head = {};
     Node* cur = &head;
+    for (int i = op->operand; i < ps->num_operands; ++i)
+        cur = cur->next = ps->operands[i];
+    ps->num_operands = op->operand;
+
+    Node* node = new_node(ND_FUNCALL, op->tok);
+    node->funcname = get_ident(op->tok);
+    node->ty = op->ty;
+    node->args = head.next;
+    push_operand(node);
+}
 
-    while (!equal(tok, ")"))
+// a "," is the comma operator unless it separates arguments, or ends an
+// assignment-expression (ex: in a declaration)
+static Node* parse_expr(Token** rest, Token* tok, bool allow_comma)
+{
+    Parser* ps = cc->parser;
+    int op_base = ps->num_ops;
+    int operand_base = ps->num_operands;
+
+    for (;;)
     {
-        if (cur != &head)
-            tok = skip(tok, ",");
-        cur = cur->next = assign(&tok, tok);
-        add_type(cur);
+        // prefix operators and "(" up to a primary expression
+        for (;;)
+        {
+            if (equal(tok, '(') && is_typename(tok + 1))
+            {
+                Token* start = tok;
+                Type* ty = typename(&tok, tok + 1);
+                tok = skip(tok, ')');
+                push_op(OP_PREFIX, 0, start, ty);
+                continue;
+            }
+            if (equal(tok, '(') && !equal(tok + 1, '{'))
+            {
+                push_op(OP_PAREN, 0, tok, NULL);
+                tok = tok + 1;
+                continue;
+            }
+            if (equal(tok, '+'))
+            {
+                tok = tok + 1;
+                continue;
+            }
+            if (equal(tok, '-') || equal(tok, '*') || equal(tok, '&') ||
+                (equal(tok, KW_SIZEOF) && !(equal(tok + 1, '(') && is_typename(tok + 2))))
+            {
+                push_op(OP_PREFIX, 0, tok, NULL);
+                tok = tok + 1;
+                continue;
+            }
+            break;
+        }
+
+        if (tok->kind == TK_IDENT && equal(tok + 1, '('))
+        {
+            // arguments are parsed as operands above the call
+            if (open_call(tok))
+            {
+                tok = tok + 2;
+                continue;
+            }
+            close_call();
+            tok = tok + 3;
+        }
+        else
+            push_operand(primary(&tok, tok));
+
+        // postfix operators and closing brackets
+        for (;;)
+        {
+            Node** top = &ps->operands[ps->num_operands - 1];
+            if (equal(tok, '.'))
+            {
+                *top = struct_ref(*top, tok + 1);
+                tok = tok + 2;
+                continue;
+            }
+            if (equal(tok, PU_ARROW))
+            {
+                // x->y is tantamount to (*x).y
+                *top = struct_ref(new_unary(ND_DEREF, *top, tok), tok + 1);
+                tok = tok + 2;
+                continue;
+            }
+            if (!equal(tok, ')') && !equal(tok, ']'))
+                break;
+
+            reduce_to(op_base, 0, false);
+            if (ps->num_ops == op_base)
+                break; // the bracket ends the expression
+            Op* op = &ps->ops[ps->num_ops - 1];
+            if (equal(tok, ']') != (op->kind == OP_SUBSCRIPT))
+                error_tok(tok, "expected '%s'", op->kind == OP_SUBSCRIPT ? "]" : ")");
+
+            if (op->kind == OP_PAREN)
+                --ps->num_ops;
+            else if (op->kind == OP_CALL)
+                close_call();
+            else
+            {
+                // x[y] => *(x + y);
+                Node* idx = ps->operands[--ps->num_operands];
+                Node* base = ps->operands[ps->num_operands - 1];
+                ps->operands[ps->num_operands - 1] = new_unary(ND_DEREF, new_add(base, idx, op->tok), op->tok);
+                --ps->num_ops;
+            }
+            tok = tok + 1;
+        }
+
+        if (equal(tok, '['))
+        {
+            push_op(OP_SUBSCRIPT, 0, tok, NULL);
+            tok = tok + 1;
+            continue;
+        }
+
+        int prec = binary_prec(tok);
+        if (!prec)
+            break;
+
+        // "=" is right associative, the others left associative
+        reduce_to(op_base, prec, equal(tok, '='));
+
+        if (equal(tok, ','))
+        {
+            if (ps->num_ops > op_base && ps->ops[ps->num_ops - 1].kind == OP_CALL)
+            {
+                tok = tok + 1;
+                continue;
+            }
+            if (ps->num_ops == op_base && !allow_comma)
+                break;
+        }
+        push_op(OP_BINARY, prec, tok, NULL);
+        tok = tok + 1;
     }
 
-    *rest = skip(tok, ")");
+    reduce_to(op_base, 0, false);
+    if (ps->num_ops > op_base)
+        error_tok(tok, "expected '%s'", ps->ops[ps->num_ops - 1].kind == OP_SUBSCRIPT ? "]" : ")");
 
-    Node* node = new_node(ND_FUNCALL, start);
-    node->funcname = strndup(start->loc, start->len);
-    node->ty = ty;
-    node->args = head.next;
+    Node* node = ps->operands[--ps->num_operands];
+    assert(ps->num_operands == operand_base);
+    *rest = tok;
     return node;
 }
 
 // primary = "(" "{" stmt+ "}" ")" |
-//           "(" expr ")" | 
-//           "sizeof" "(" typename ")" | 
-//           "sizeof" unary | ident func-args? | str | num
+//           "sizeof" "(" typename ")" |
+//           ident | str | num
 static Node* primary(Token** rest, Token* tok)
 {
     Token* start = tok;
 
-    if (equal(tok, "(") && equal(tok->next, "{"))
+    if (equal(tok, '(') && equal(tok + 1, '{'))
     {
         // this is a GNU statement expression
         Node* node = new_node(ND_STMT_EXPR, tok);
-        node->body = compound_stmt(&tok, tok->next->next)->body;
-        *rest = skip(tok, ")");
-        return node;
-    }
-    if (equal(tok, "("))
-    {
-        Node* node = expr(&tok, tok->next);
-        *rest = skip(tok, ")");
+        node->body = compound_stmt(&tok, tok + 2)->body;
+        add_type(node);
+        *rest = skip(tok, ')');
         return node;
     }
-    if (equal(tok, "sizeof") && equal(tok->next, "(") && is_typename(tok->next->next)) {
-        Type* ty = typename(&tok, tok->next->next);
-        *rest = skip(tok, ")");
+    if (equal(tok, KW_SIZEOF) && equal(tok + 1, '(') && is_typename(tok + 2)) {
+        Type* ty = typename(&tok, tok + 2);
+        *rest = skip(tok, ')');
         return new_num(ty->size, start);
     }
 
-    if (equal(tok, "sizeof"))
-    {
-        Node* node = unary(rest, tok->next);
-        add_type(node);
-        return new_num(node->ty->size, tok);
-    }
-
     if (tok->kind == TK_IDENT)
     {
-        // function call
-        if (equal(tok->next, "("))
-            return funcall(rest, tok);
-
         // variable
         VarScope* sc = find_var(tok);
         if (!sc || !sc->var)
             error_tok(tok, "undefined variable");
-        // var = new_lvar(strndup(tok->loc, tok->len));
-        // strndup: creates null terminated copy of first param with at most second param bytes
-        *rest = tok->next;
+        reference(sc->var);
+        *rest = tok + 1;
         return new_var_node(sc->var, tok);
     }
 
     if (tok->kind == TK_STR)
     {
-        Obj* var = new_string_literal(tok->str, tok->ty);
-        *rest = tok->next;
+        Literal* lit = get_literal(tok);
+        Obj* var = new_string_literal(lit->str, array_of(ty_char, lit->len));
+        *rest = tok + 1;
         return new_var_node(var, tok);
     }
 
     if (tok->kind == TK_NUM)
     {
-        Node* node = new_num(tok->val, tok);
-        *rest = tok->next;
+        Node* node = new_num(get_literal(tok)->val, tok);
+        *rest = tok + 1;
         return node;
     }
     error_tok(tok, "unexpected expression");
@@ -1090,12 +1644,12 @@ static Node* primary(Token** rest, Token* tok)
 // parse declaration of typedef
 static Token* parse_typedef(Token* tok, Type* basety) {
     bool first = true;
-    while (!consume(&tok, tok, ";")) {
+    while (!consume(&tok, tok, ';')) {
         if (!first)
-            tok = skip(tok, ",");
+            tok = skip(tok, ',');
         first = false;
         Type* ty = declarator(&tok, tok, basety);
-        push_scope(get_ident(ty->name))->type_def = ty;
+        push_scope(ty->name)->type_def = ty;
     }
     return tok;
 }
@@ -1106,46 +1660,401 @@ static void create_param_lvars(Type* param)
     if (param)
     {
         create_param_lvars(param->next);
-        new_lvar(get_ident(param->name), param);
+        new_lvar(param->name, param);
     }
 }
 
-// declaration/definition of function
-static Token* function(Token* tok, Type* basety)
+// fingerprints of function definitions, which name their assembly in the
+// sidecar file of an incremental compilation (see fncache.c)
+// a fingerprint covers what the code generated for a body depends on: the
+// tokens of the body, with their lines relative to the body since .loc
+// directives are, and the declarations at file scope that its names refer to,
+// which are hashed down to the members of the structs they use
+
+// a few words are hashed per token, so each is mixed in at once rather than
+// byte by byte as hash_bytes() does
+static Hash hash_int(Hash h, int64_t val)
 {
-    Type* ty = declarator(&tok, tok, basety);
-    Obj* fn = new_gvar(get_ident(ty->name), ty);
-    fn->is_function = true;
-    fn->is_definition = !consume(&tok, tok, ";");
+    h ^= (uint64_t)val;
+    return (h << 88) + h * 0x13b;
+}
 
-    if (!fn->is_definition)
-        return tok;
+static Hash hash_type(Hash h, Type* ty)
+{
+    Parser* ps = cc->parser;
+    if (!ty)
+        return hash_int(h, -1);
+    h = hash_int(h, ty->kind);
+    h = hash_int(h, ty->size);
+    h = hash_int(h, ty->align);
+    h = hash_int(h, ty->array_len);
+
+    switch (ty->kind)
+    {
+    case TY_PTR:
+    case TY_ARRAY:
+        return hash_type(h, ty->base);
+    case TY_FUNC:
+        h = hash_type(h, ty->return_ty);
+        for (Type* param = ty->params; param; param = param->next)
+            h = hash_type(h, param);
+        return hash_int(h, -1);
+    case TY_STRUCT:
+    case TY_UNION:
+    {
+        // a struct hashed before is referred to by its index, which also ends
+        // the recursion of a struct that points to itself
+        for (int i = 0; i < ps->num_hashed_types; ++i)
+            if (ps->hashed_types[i] == ty)
+                return hash_int(h, -2 - i);
+        if (ps->num_hashed_types == ps->hashed_type_capacity)
+        {
+            ps->hashed_type_capacity = ps->hashed_type_capacity ? ps->hashed_type_capacity * 2 : 16;
+            ps->hashed_types = realloc(ps->hashed_types, sizeof(Type*) * ps->hashed_type_capacity);
+        }
+        ps->hashed_types[ps->num_hashed_types++] = ty;
 
-    current_fn = fn;
-    locals = NULL;
+        for (Member* mem = ty->members; mem; mem = mem->next)
+        {
+            h = hash_string(h, mem->name);
+            h = hash_int(h, mem->offset);
+            h = hash_type(h, mem->ty);
+        }
+        return hash_int(h, -1);
+    }
+    }
+    return h;
+}
+
+// what the name tok refers to at file scope
+static Hash hash_binding(Hash h, Token* tok)
+{
+    VarScope* vs = find_var(tok);
+    if (!vs)
+        h = hash_int(h, 0);
+    else if (vs->type_def)
+        h = hash_type(hash_int(h, 1), vs->type_def);
+    else
+    {
+        Obj* var = vs->var;
+        h = hash_int(h, 2);
+        h = hash_int(h, var->is_function);
+        h = hash_int(h, var->is_static);
+        h = hash_type(h, var->ty);
+    }
+    return hash_type(h, find_tag(tok));
+}
+
+// fn is defined by the tokens from its body_tok to end
+static Hash fingerprint(Obj* fn, Token* end)
+{
+    Parser* ps = cc->parser;
+    ps->num_hashed_types = 0;
+
+    Hash h = hash_string(HASH_INIT, fn->name);
+    h = hash_int(h, fn->is_static);
+    h = hash_type(h, fn->ty);
+    for (Type* param = fn->ty->params; param; param = param->next)
+        h = hash_string(h, get_ident(param->name));
+
+    int file = file_number(fn->body_tok);
+    int line = line_number(fn->body_tok);
+    for (Token* tok = fn->body_tok; tok < end; ++tok)
+    {
+        h = hash_int(h, tok->kind);
+        h = hash_int(h, tok->id);
+        if (tok->kind == TK_IDENT)
+        {
+            h = hash_string(h, symbol_name(tok->sym));
+            h = hash_binding(h, tok);
+        }
+        else if (tok->kind == TK_NUM)
+            h = hash_int(h, get_literal(tok)->val);
+        else if (tok->kind == TK_STR)
+        {
+            Literal* lit = get_literal(tok);
+            h = hash_bytes(hash_int(h, lit->len), lit->str, lit->len);
+        }
+
+        int tok_file = file_number(tok);
+        if (tok_file == file)
+            h = hash_int(h, line_number(tok) - line);
+        else
+            h = hash_int(hash_string(h, source_file_name(tok_file)), line_number(tok));
+    }
+    return h;
+}
+
+// parses the body of fn at file scope; returns the token following it
+// a deferred body only sees the file-scope declarations that precede its
+// definition, as it would have if parsed there
+// an incremental compilation reuses the assembly of a body that did not
+// change rather than parse it
+static Token* function_body(Obj* fn)
+{
+    Parser* ps = cc->parser;
+    ps->hidden_from = fn->scope_mark;
+    ps->hidden_to = ps->num_bindings;
+    if (cc->fns && equal(fn->body_tok, '{'))
+    {
+        Token* end = skip_brackets(fn->body_tok);
+        fn->hash = fingerprint(fn, end);
+        Fragment* frag = find_fragment(cc->fns, fn->hash);
+        if (frag)
+        {
+            fn->fragment = frag;
+            fn->is_definition = true;
+            for (int i = 0; i < frag->num_refs; ++i)
+            {
+                int sym = intern(frag->refs[i], strlen(frag->refs[i]));
+                if (sym < ps->var_binding_capacity && ps->var_bindings[sym] && ps->var_bindings[sym]->var)
+                    reference(ps->var_bindings[sym]->var);
+            }
+            ps->hidden_from = ps->hidden_to = 0;
+            return end;
+        }
+    }
+
+    ps->current_fn = fn;
+    ps->literal_id = 0;
+    ps->num_refs = 0;
+    ps->locals = NULL;
     enter_scope();
-    create_param_lvars(ty->params);
-    fn->params = locals;
+    create_param_lvars(fn->ty->params);
+    fn->params = ps->locals;
 
-    tok = skip(tok, "{");
+    Token* tok = skip(fn->body_tok, '{');
     fn->body = compound_stmt(&tok, tok);
-    fn->locals = locals;
+    fn->locals = ps->locals;
+    fn->is_definition = true;
     leave_scope();
+
+    if (cc->fns)
+    {
+        fn->num_refs = ps->num_refs;
+        fn->refs = region_alloc(&ps->objects, sizeof(Obj*) * ps->num_refs);
+        if (ps->num_refs)
+            memcpy(fn->refs, ps->refs, sizeof(Obj*) * ps->num_refs);
+    }
+    ps->current_fn = NULL;
+    ps->hidden_from = ps->hidden_to = 0;
     return tok;
 }
 
-static Token* global_variable(Token* tok, Type* basety)
+// declaration/definition of function
+// all declarations of a function share one object, so that a call through
+// an earlier declaration references the definition
+static Token* function(Token* tok, Type* basety, VarAttr* attr)
+{
+    Type* ty = declarator(&tok, tok, basety);
+    VarScope* sc = find_var(ty->name);
+    Obj* fn = sc && sc->var && sc->var->is_function ? sc->var : NULL;
+    if (!fn)
+    {
+        fn = new_gvar(ty->name, ty);
+        fn->is_function = true;
+    }
+    fn->is_static |= attr->is_static;
+
+    if (consume(&tok, tok, ';'))
+        return tok;
+
+    if (fn->body_tok)
+        error_tok(ty->name, "redefinition of '%s'", fn->name);
+    fn->ty = ty; // the parameter names are those of the definition
+    fn->body_tok = tok;
+    fn->scope_mark = cc->parser->num_bindings;
+
+    // a function with external linkage must be emitted; the body of a static
+    // one is only brace-matched until the function is referenced
+    if (!fn->is_static || fn->is_referenced)
+        return function_body(fn);
+    if (!equal(tok, '{'))
+        error_tok(tok, "expected '{'");
+    return skip_brackets(tok);
+}
+
+// constant expressions
+// evaluated over the AST once it is built; an initializer of a global may
+// also be the address of a global plus an offset, which is returned as the
+// label of that global and the offset
+
+static int64_t eval2(Node* node, char** label);
+
+static int64_t eval(Node* node)
+{
+    return eval2(node, NULL);
+}
+
+// evaluates the address of the lvalue node
+static int64_t eval_rval(Node* node, char** label)
+{
+    switch (node->kind)
+    {
+    case ND_VAR:
+        if (node->var->is_local)
+            error_tok(node->tok, "not a compile-time constant");
+        *label = node->var->name;
+        return 0;
+    case ND_DEREF:
+        return eval2(node->lhs, label);
+    case ND_MEMBER:
+        return eval_rval(node->lhs, label) + node->member->offset;
+    }
+    error_tok(node->tok, "invalid initializer");
+}
+
+// label is NULL where only an integer is allowed
+static int64_t eval2(Node* node, char** label)
+{
+    switch (node->kind)
+    {
+    case ND_NUM:
+        return node->val;
+    case ND_ADD:
+        return eval2(node->lhs, label) + eval(node->rhs);
+    case ND_SUB:
+        return eval2(node->lhs, label) - eval(node->rhs);
+    case ND_MUL:
+        return eval(node->lhs) * eval(node->rhs);
+    case ND_DIV:
+    {
+        int64_t rhs = eval(node->rhs);
+        if (rhs == 0)
+            error_tok(node->rhs->tok, "division by zero");
+        return eval(node->lhs) / rhs;
+    }
+    case ND_NEG:
+        return -eval(node->lhs);
+    case ND_EQ:
+        return eval(node->lhs) == eval(node->rhs);
+    case ND_NE:
+        return eval(node->lhs) != eval(node->rhs);
+    case ND_LT:
+        return eval(node->lhs) < eval(node->rhs);
+    case ND_LE:
+        return eval(node->lhs) <= eval(node->rhs);
+    case ND_CAST:
+    {
+        int64_t val = eval2(node->lhs, label);
+        if (!is_integer(node->ty))
+            return val;
+        if (label && *label && node->ty->size < 8)
+            error_tok(node->tok, "address does not fit in '%d' bytes", node->ty->size);
+        return wrap_to(node->ty, val);
+    }
+    case ND_ADDR:
+        if (!label)
+            break;
+        return eval_rval(node->lhs, label);
+    case ND_VAR:
+    case ND_MEMBER:
+    case ND_DEREF:
+        // an array or a function decays to its address
+        if (!label || (node->ty->kind != TY_ARRAY && node->ty->kind != TY_FUNC))
+            break;
+        return eval_rval(node, label);
+    }
+    error_tok(node->tok, "not a compile-time constant");
+}
+
+static int64_t const_expr(Token** rest, Token* tok)
+{
+    return eval(assign(rest, tok));
+}
+
+// global initializers
+// the initializer is written into the bytes of the variable, which are
+// emitted to .data as they are instead of being stored by startup code
+
+static void write_buf(char* buf, uint64_t val, int size)
+{
+    for (int i = 0; i < size; ++i)
+        buf[i] = val >> (i * 8);
+}
+
+// the initializer of a member or an element may omit its braces only if it
+// is a scalar; a char array may also be initialized by a string literal
+// initializer = "{" initializer ("," initializer)* ","? "}" | string | assign
+static Relocation* gvar_initializer(Token** rest, Token* tok, Type* ty, char* buf, int offset, Relocation* cur)
+{
+    if (ty->kind == TY_ARRAY && ty->base->kind == TY_CHAR && tok->kind == TK_STR)
+    {
+        Literal* lit = get_literal(tok);
+        int len = lit->len < ty->array_len ? lit->len : ty->array_len;
+        memcpy(buf + offset, lit->str, len);
+        *rest = tok + 1;
+        return cur;
+    }
+
+    if (ty->kind == TY_ARRAY || ty->kind == TY_STRUCT || ty->kind == TY_UNION)
+    {
+        tok = skip(tok, '{');
+        Member* mem = ty->kind == TY_ARRAY ? NULL : ty->members;
+        for (int i = 0; !consume(rest, tok, '}'); ++i)
+        {
+            if (i > 0)
+            {
+                tok = skip(tok, ',');
+                if (consume(rest, tok, '}'))
+                    break;
+            }
+
+            if (ty->kind == TY_ARRAY)
+            {
+                if (i >= ty->array_len)
+                    error_tok(tok, "excess elements in array initializer");
+                cur = gvar_initializer(&tok, tok, ty->base, buf, offset + ty->base->size * i, cur);
+                continue;
+            }
+
+            // a union is initialized by its first member only
+            if (!mem || (ty->kind == TY_UNION && i > 0))
+                error_tok(tok, "excess elements in %s initializer", ty->kind == TY_UNION ? "union" : "struct");
+            cur = gvar_initializer(&tok, tok, mem->ty, buf, offset + mem->offset, cur);
+            mem = mem->next;
+        }
+        return cur;
+    }
+
+    Node* node = new_cast(assign(rest, tok), ty);
+    char* label = NULL;
+    int64_t val = eval2(node, &label);
+
+    if (!label)
+    {
+        write_buf(buf + offset, val, ty->size);
+        return cur;
+    }
+
+    Relocation* rel = region_alloc(&cc->parser->objects, sizeof(Relocation));
+    rel->offset = offset;
+    rel->label = label;
+    rel->addend = val;
+    return cur->next = rel;
+}
+
+static Token* global_variable(Token* tok, Type* basety, VarAttr* attr)
 {
     bool first = true;
 
-    while (!consume(&tok, tok, ";"))
+    while (!consume(&tok, tok, ';'))
     {
         if (!first)
-            tok = skip(tok, ",");
+            tok = skip(tok, ',');
         first = false;
 
         Type* ty = declarator(&tok, tok, basety);
-        new_gvar(get_ident(ty->name), ty);
+        Obj* var = new_gvar(ty->name, ty);
+        var->is_static = attr->is_static;
+
+        if (consume(&tok, tok, '='))
+        {
+            Relocation head = {};
+            var->init_data = region_alloc(&cc->parser->objects, ty->size);
+            gvar_initializer(&tok, tok, ty, var->init_data, 0, &head);
+            var->rel = head.next;
+        }
     }
     return tok;
 }
@@ -1153,22 +2062,25 @@ static Token* global_variable(Token* tok, Type* basety)
 // look ahead of tokens and return true if a give token is a start of a function def/declaration
 static bool is_function(Token* tok)
 {
-    if (equal(tok->next, ";"))
+    if (equal(tok + 1, ';'))
     {
         return false;
     }
 
-    Type dummy = {};
-    Type* ty = declarator(&tok, tok, &dummy);
-    return ty->kind == TY_FUNC;
+    return scan_declarator(&tok, tok) == TY_FUNC;
 }
 
 // program = (typedef | function-definition | global-varaibles)*
 Obj* parse(Token* tok)
 {
-    globals = NULL;
-    while (tok->kind != TK_EOF)
+    Parser* ps = cc->parser;
+    ps->globals = NULL;
+    for (;;)
     {
+        // a streamed input is handed over one top-level declaration at a time
+        if (tok->kind == TK_EOF && (tok = preprocess(tokenize_more()))->kind == TK_EOF)
+            break;
+
         VarAttr attr = {};
         Type* basety = declspec(&tok, tok, &attr);
 
@@ -1180,13 +2092,60 @@ Obj* parse(Token* tok)
 
         // function
         if (is_function(tok))
-        {
-            tok = function(tok, basety);
-            continue;
-        }
+            tok = function(tok, basety, &attr);
+        else
+            tok = global_variable(tok, basety, &attr);
 
-        // global variables
-        tok = global_variable(tok, basety);
+        // static functions referenced by the declaration
+        while (ps->num_pending_bodies > 0)
+            function_body(ps->pending_bodies[--ps->num_pending_bodies]);
     }
-    return globals;
-}
\ No newline at end of file
+    return ps->globals;
+}
+// releases the objects of the translation unit last parsed, which the program
+// returned by parse() points to; the types are released by reset_types()
+void reset_parser(void)
+{
+    Parser* ps = cc->parser;
+    region_reset(&ps->nodes);
+    region_reset(&ps->scopes);
+    region_reset(&ps->objects);
+
+    if (ps->var_bindings)
+        memset(ps->var_bindings, 0, sizeof(VarScope*) * ps->var_binding_capacity);
+    if (ps->tag_bindings)
+        memset(ps->tag_bindings, 0, sizeof(TagScope*) * ps->tag_binding_capacity);
+    ps->file_scope = (Scope) {};
+    ps->scope = &ps->file_scope;
+    ps->globals = ps->locals = NULL;
+    ps->current_fn = NULL;
+    ps->num_pending_bodies = 0;
+    ps->num_bindings = 0;
+    ps->hidden_from = ps->hidden_to = 0;
+    ps->num_ops = 0;
+    ps->num_operands = 0;
+    ps->unique_id = 0;
+    ps->num_refs = 0;
+}
+
+Parser* new_parser(void)
+{
+    Parser* ps = calloc(1, sizeof(Parser));
+    ps->scope = &ps->file_scope;
+    return ps;
+}
+
+void free_parser(Parser* ps)
+{
+    region_free(&ps->nodes);
+    region_free(&ps->scopes);
+    region_free(&ps->objects);
+    free(ps->var_bindings);
+    free(ps->tag_bindings);
+    free(ps->pending_bodies);
+    free(ps->ops);
+    free(ps->operands);
+    free(ps->refs);
+    free(ps->hashed_types);
+    free(ps);
+}
@@ -0,0 +1,1483 @@
+#include "au_cc.h"
+
+// C preprocessor
+// works on the token arrays of the lexer: directives are executed and macros
+// are expanded as the tokens are copied into a new array for the parser.
+// included files are lexed once per compilation (see file_tokens()), and a
+// file guarded by #pragma once or by an include guard is not entered again
+
+// macro expansion follows Prosser's algorithm: every token in flight carries
+// the set of macros it was expanded from (its hideset) and is not expanded
+// by a macro in that set. a token that is found in its own hideset is marked
+// TF_NOEXPAND, so tokens that leave the expander do not need their hidesets
+typedef struct Hideset Hideset;
+struct Hideset
+{
+    Hideset* next;
+    int sym;
+};
+
+// a token being expanded
+typedef struct
+{
+    Token tok;
+    Hideset* hideset;
+} Item;
+
+typedef struct
+{
+    Item* data;
+    int len;
+    int capacity;
+} ItemVec;
+
+typedef struct Macro Macro;
+struct Macro
+{
+    bool is_objlike; // object-like or function-like
+    int* params;     // parameter names
+    int num_params;
+
+    // the replacement list, in the token array of the #define line
+    Token* body;
+    int body_len;
+
+    Token (*handler)(Token* tok); // builtin macro (ex: __LINE__)
+};
+
+// `#if` group
+typedef struct
+{
+    Token* tok; // the directive, for error messages
+    enum { IN_THEN, IN_ELIF, IN_ELSE } ctx;
+    bool included; // a group of the conditional has been included
+} CondIncl;
+
+// the file being read and the files including it
+// tokens are read from the top frame once pending (below) is empty
+typedef struct
+{
+    Token* tok;     // next token
+    int file_no;    // 0 for the main file, which may be streamed in chunks
+    int cond_depth; // num_conds when the file was entered
+} Frame;
+
+// what is known about an included file, indexed by file number
+typedef struct
+{
+    bool included;
+    bool pragma_once;
+    bool guard_checked;
+    int guard; // symbol of the include guard macro, or -1
+} FileInfo;
+
+// the state of the preprocessor of a compiler (see Compiler)
+struct Preprocessor
+{
+    char** include_paths;
+    int num_include_paths;
+
+    // symbols of the directive names and other special identifiers
+    struct
+    {
+        int define, undef, include, ifdef, ifndef, elif, endif, error, pragma, line;
+        int once, defined;
+    } names;
+
+    // the rest is the state of a translation unit
+
+    // macros, indexed by the symbol of their name
+    Macro** macros;
+    int macro_capacity;
+
+    CondIncl* conds;
+    int num_conds;
+    int cond_capacity;
+
+    Frame* frames;
+    int num_frames;
+    int frame_capacity;
+
+    // tokens produced by macro expansion that are yet to be read, last one first
+    ItemVec pending;
+
+    // skipping the rest of a group whose condition is false; the state survives
+    // the end of a chunk of a streamed main file
+    bool skipping;
+    int skip_depth; // nesting of conditionals within the skipped group
+
+    FileInfo* file_info;
+    int file_info_capacity;
+
+    // resolved #include operands, indexed by an interned key (see resolve_include())
+    int* include_cache;
+    int include_cache_capacity;
+
+    Region hidesets;
+
+    // nesting of #if operands that are parsed but not evaluated (ex: the rhs of 0 && x)
+    int unevaluated;
+
+    // the token array returned by preprocess()
+    Token* result;
+    int result_len;
+    int result_capacity;
+
+    // every array returned, referenced by the AST until the unit ends
+    Token** outputs;
+    int num_outputs;
+    int output_capacity;
+
+    bool active; // a translation unit has been started
+};
+
+static Token eof_token = { .kind = TK_EOF };
+
+static void push_item(ItemVec* v, Item item)
+{
+    if (v->len == v->capacity)
+    {
+        v->capacity = v->capacity ? v->capacity * 2 : 16;
+        v->data = realloc(v->data, sizeof(Item) * v->capacity);
+    }
+    v->data[v->len++] = item;
+}
+
+static bool hideset_contains(Hideset* hs, int sym)
+{
+    for (; hs; hs = hs->next)
+        if (hs->sym == sym)
+            return true;
+    return false;
+}
+
+static Hideset* hideset_add(Hideset* hs, int sym)
+{
+    if (hideset_contains(hs, sym))
+        return hs;
+    Hideset* h = region_alloc(&cc->pp->hidesets, sizeof(Hideset));
+    h->next = hs;
+    h->sym = sym;
+    return h;
+}
+
+static Hideset* hideset_union(Hideset* a, Hideset* b)
+{
+    for (; b; b = b->next)
+        a = hideset_add(a, b->sym);
+    return a;
+}
+
+static Hideset* hideset_intersection(Hideset* a, Hideset* b)
+{
+    Hideset* hs = NULL;
+    for (; a; a = a->next)
+        if (hideset_contains(b, a->sym))
+            hs = hideset_add(hs, a->sym);
+    return hs;
+}
+
+static bool is_name(Token* tok, int sym)
+{
+    return tok->kind == TK_IDENT && tok->sym == sym;
+}
+
+// '#' starting a directive line
+static bool is_hash(Token* tok)
+{
+    return (tok->flags & TF_BOL) && equal(tok, '#');
+}
+
+// "##" in a replacement list; the lexer yields two '#' tokens
+static bool is_paste(Token* tok, Token* end)
+{
+    return equal(tok, '#') && tok + 1 < end && equal(tok + 1, '#') && !(tok[1].flags & TF_SPACE);
+}
+
+// returns the first token of the next line
+static Token* skip_line(Token* tok)
+{
+    while (tok->kind != TK_EOF && !(tok->flags & TF_BOL))
+        ++tok;
+    return tok;
+}
+
+static Macro* find_macro(Token* tok)
+{
+    Preprocessor* pp = cc->pp;
+    if (tok->kind != TK_IDENT || tok->sym >= pp->macro_capacity)
+        return NULL;
+    return pp->macros[tok->sym];
+}
+
+static void free_macro(Macro* m)
+{
+    if (m)
+        free(m->params);
+    free(m);
+}
+
+// defines sym, replacing any definition it has
+static Macro* add_macro(int sym, bool is_objlike)
+{
+    Preprocessor* pp = cc->pp;
+    if (sym >= pp->macro_capacity)
+    {
+        int capacity = pp->macro_capacity ? pp->macro_capacity : 256;
+        while (capacity <= sym)
+            capacity *= 2;
+        pp->macros = realloc(pp->macros, sizeof(Macro*) * capacity);
+        memset(pp->macros + pp->macro_capacity, 0, sizeof(Macro*) * (capacity - pp->macro_capacity));
+        pp->macro_capacity = capacity;
+    }
+
+    Macro* m = calloc(1, sizeof(Macro));
+    m->is_objlike = is_objlike;
+    free_macro(pp->macros[sym]);
+    pp->macros[sym] = m;
+    return m;
+}
+
+static FileInfo* get_file_info(int file_no)
+{
+    Preprocessor* pp = cc->pp;
+    if (file_no >= pp->file_info_capacity)
+    {
+        int capacity = pp->file_info_capacity ? pp->file_info_capacity * 2 : 64;
+        while (capacity <= file_no)
+            capacity *= 2;
+        pp->file_info = realloc(pp->file_info, sizeof(FileInfo) * capacity);
+        memset(pp->file_info + pp->file_info_capacity, 0, sizeof(FileInfo) * (capacity - pp->file_info_capacity));
+        pp->file_info_capacity = capacity;
+    }
+    return &pp->file_info[file_no];
+}
+
+// returns the frame being read; included files that have been read to the
+// end are left, which requires their conditionals to be terminated
+static Frame* current_frame(void)
+{
+    Preprocessor* pp = cc->pp;
+    Frame* f = &pp->frames[pp->num_frames - 1];
+    while (f->tok->kind == TK_EOF && pp->num_frames > 1)
+    {
+        if (pp->num_conds > f->cond_depth)
+            error_tok(pp->conds[pp->num_conds - 1].tok, "unterminated conditional directive");
+        f = &pp->frames[--pp->num_frames - 1];
+    }
+    return f;
+}
+
+// returns the next token of the input; *frame is set to the file it was read
+// from, or NULL if it was produced by macro expansion (thus not a directive)
+static Item read_item(Frame** frame)
+{
+    Preprocessor* pp = cc->pp;
+    if (pp->pending.len)
+    {
+        *frame = NULL;
+        return pp->pending.data[--pp->pending.len];
+    }
+
+    Frame* f = current_frame();
+    *frame = f;
+    Item item = { *f->tok, NULL };
+    if (f->tok->kind != TK_EOF)
+        ++f->tok;
+    return item;
+}
+
+// whether the next token of the input is id, without reading it
+// a directive in between ends the lookahead
+static bool peek_is(int id)
+{
+    Preprocessor* pp = cc->pp;
+    if (pp->pending.len)
+        return equal(&pp->pending.data[pp->pending.len - 1].tok, id);
+    Token* tok = current_frame()->tok;
+    return !is_hash(tok) && equal(tok, id);
+}
+
+// pushes items so that items[0] is read first
+// items is the expansion of the macro invocation starting at origin
+static void push_back(ItemVec* items, Token* origin)
+{
+    Preprocessor* pp = cc->pp;
+    for (int i = items->len - 1; i >= 0; --i)
+        push_item(&pp->pending, items->data[i]);
+
+    // the expansion takes the place of the macro invocation
+    if (items->len)
+    {
+        Token* first = &pp->pending.data[pp->pending.len - 1].tok;
+        first->flags = (first->flags & ~(TF_BOL | TF_SPACE)) | (origin->flags & (TF_BOL | TF_SPACE));
+    }
+}
+
+static void expand(ItemVec* out);
+
+// fully macro-expands a list of items on its own, as done for macro
+// arguments and the operands of #if and #include
+static ItemVec expand_items(ItemVec* items)
+{
+    Preprocessor* pp = cc->pp;
+    int saved = pp->pending.len;
+    push_item(&pp->pending, (Item) { eof_token, NULL });
+    for (int i = items->len - 1; i >= 0; --i)
+        push_item(&pp->pending, items->data[i]);
+
+    ItemVec out = {};
+    expand(&out);
+    assert(pp->pending.len == saved);
+    return out;
+}
+
+// spelling of the tokens of a macro argument, as required by the '#' operator
+static char* join_tokens(ItemVec* items)
+{
+    char* buf;
+    size_t buflen;
+    FILE* out = open_memstream(&buf, &buflen);
+    for (int i = 0; i < items->len; ++i)
+    {
+        Token* tok = &items->data[i].tok;
+        if (i > 0 && (tok->flags & TF_SPACE))
+            fputc(' ', out);
+        print_token_text(out, tok);
+    }
+    fclose(out);
+    return buf;
+}
+
+// returns a string literal token holding text
+static Token new_str_token(char* text, Token* origin)
+{
+    char* buf = malloc(strlen(text) * 2 + 3);
+    char* q = buf;
+    *q++ = '"';
+    for (char* p = text; *p; ++p)
+    {
+        if (*p == '\\' || *p == '"')
+            *q++ = '\\';
+        *q++ = *p;
+    }
+    *q++ = '"';
+    *q = '\0';
+
+    Token* tok = tokenize_fragment(buf, origin);
+    free(buf);
+    return tok[0];
+}
+
+static Token new_num_token(int64_t val, Token* origin)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%ld", (long)val);
+    return tokenize_fragment(buf, origin)[0];
+}
+
+// concatenates two tokens into a new one (the '##' operator)
+static Token paste(Token* lhs, Token* rhs)
+{
+    char* buf;
+    size_t len;
+    FILE* out = open_memstream(&buf, &len);
+    print_token_text(out, lhs);
+    print_token_text(out, rhs);
+    fclose(out);
+
+    Token* tok = tokenize_fragment(buf, lhs);
+    if (!tok || tok->kind == TK_EOF || tok[1].kind != TK_EOF)
+    {
+        // error_tok() does not return, so buf is freed before it
+        char text[256];
+        snprintf(text, sizeof(text), "%s", buf);
+        free(buf);
+        error_tok(lhs, "pasting forms '%s', an invalid token", text);
+    }
+    free(buf);
+
+    Token result = tok[0];
+    result.flags = lhs->flags & TF_SPACE;
+    return result;
+}
+
+static int param_index(Macro* m, Token* tok)
+{
+    if (tok->kind != TK_IDENT)
+        return -1;
+    for (int i = 0; i < m->num_params; ++i)
+        if (m->params[i] == tok->sym)
+            return i;
+    return -1;
+}
+
+// substitutes the arguments for the parameters in the replacement list of m
+static ItemVec subst(Macro* m, ItemVec* args, Token* origin)
+{
+    ItemVec out = {};
+    ItemVec* expanded = calloc(m->num_params, sizeof(ItemVec));
+    bool* is_expanded = calloc(m->num_params, sizeof(bool));
+    Token* end = m->body + m->body_len;
+
+    for (Token* tok = m->body; tok < end;)
+    {
+        // "#" param: stringize the argument
+        int idx;
+        if (equal(tok, '#') && !is_paste(tok, end) && tok + 1 < end && (idx = param_index(m, tok + 1)) >= 0)
+        {
+            char* text = join_tokens(&args[idx]);
+            Item item = { new_str_token(text, origin), NULL };
+            free(text);
+            item.tok.flags = tok->flags & TF_SPACE;
+            push_item(&out, item);
+            tok += 2;
+            continue;
+        }
+
+        // x ## y: paste y onto the last token produced
+        if (is_paste(tok, end))
+        {
+            if (out.len == 0)
+                error_tok(tok, "'##' cannot appear at start of macro expansion");
+            tok += 2;
+            if (tok == end)
+                error_tok(tok - 1, "'##' cannot appear at end of macro expansion");
+
+            Token* lhs = &out.data[out.len - 1].tok;
+            if ((idx = param_index(m, tok)) >= 0)
+            {
+                // an empty argument leaves the left operand as it is
+                ItemVec* arg = &args[idx];
+                if (arg->len)
+                {
+                    *lhs = paste(lhs, &arg->data[0].tok);
+                    for (int i = 1; i < arg->len; ++i)
+                        push_item(&out, arg->data[i]);
+                }
+            }
+            else
+            {
+                Token rhs = *tok;
+                rhs.offset = origin->offset;
+                *lhs = paste(lhs, &rhs);
+            }
+            ++tok;
+            continue;
+        }
+
+        idx = param_index(m, tok);
+
+        // an operand of "##" is not expanded
+        if (idx >= 0 && is_paste(tok + 1, end))
+        {
+            ItemVec* arg = &args[idx];
+            if (arg->len == 0)
+            {
+                // the right operand is taken as it is
+                Token* rhs = tok + 3;
+                int rhs_idx = rhs < end ? param_index(m, rhs) : -1;
+                if (rhs_idx >= 0)
+                {
+                    for (int i = 0; i < args[rhs_idx].len; ++i)
+                        push_item(&out, args[rhs_idx].data[i]);
+                    tok = rhs + 1;
+                }
+                else if (rhs < end)
+                {
+                    Item item = { *rhs, NULL };
+                    item.tok.offset = origin->offset;
+                    push_item(&out, item);
+                    tok = rhs + 1;
+                }
+                else
+                    tok = rhs;
+                continue;
+            }
+
+            for (int i = 0; i < arg->len; ++i)
+                push_item(&out, arg->data[i]);
+            ++tok;
+            continue;
+        }
+
+        // a parameter is replaced by its fully expanded argument
+        if (idx >= 0)
+        {
+            if (!is_expanded[idx])
+            {
+                expanded[idx] = expand_items(&args[idx]);
+                is_expanded[idx] = true;
+            }
+
+            ItemVec* arg = &expanded[idx];
+            for (int i = 0; i < arg->len; ++i)
+            {
+                push_item(&out, arg->data[i]);
+                if (i == 0)
+                    out.data[out.len - 1].tok.flags = (arg->data[0].tok.flags & ~TF_SPACE) | (tok->flags & TF_SPACE);
+            }
+            ++tok;
+            continue;
+        }
+
+        Item item = { *tok, NULL };
+        item.tok.offset = origin->offset;
+        push_item(&out, item);
+        ++tok;
+    }
+
+    for (int i = 0; i < m->num_params; ++i)
+        free(expanded[i].data);
+    free(expanded);
+    free(is_expanded);
+    return out;
+}
+
+// reads the arguments of a function-like macro invocation, the '(' having
+// been read, and stores the ')' in *rparen
+static ItemVec* read_macro_args(Macro* m, Token* name, Item* rparen)
+{
+    ItemVec* args = calloc(m->num_params ? m->num_params : 1, sizeof(ItemVec));
+    int num_args = 0;
+    int depth = 0;
+    ItemVec* arg = &args[0];
+    Frame* frame;
+
+    for (;;)
+    {
+        Item item = read_item(&frame);
+        Token* tok = &item.tok;
+        if (tok->kind == TK_EOF)
+            error_tok(name, "unterminated list of macro arguments");
+
+        if (depth == 0 && equal(tok, ')'))
+        {
+            *rparen = item;
+            break;
+        }
+
+        if (depth == 0 && equal(tok, ','))
+        {
+            if (++num_args >= m->num_params)
+                error_tok(tok, "too many arguments");
+            arg = &args[num_args];
+            continue;
+        }
+
+        if (equal(tok, '(') || equal(tok, '['))
+            ++depth;
+        else if (equal(tok, ')') || equal(tok, ']'))
+            --depth;
+
+        // arguments are read across lines, which do not matter within them
+        tok->flags &= ~TF_BOL;
+        push_item(arg, item);
+    }
+
+    // f() passes one empty argument
+    if (num_args + 1 < m->num_params)
+        error_tok(name, "too few arguments");
+    if (m->num_params == 0 && args[0].len)
+        error_tok(&args[0].data[0].tok, "too many arguments");
+    return args;
+}
+
+// expands the macro named by item if it is one; the expansion is pushed back
+// to be read again. returns false if item is to be passed through
+static bool expand_macro(Item* item)
+{
+    Token* tok = &item->tok;
+    Macro* m = find_macro(tok);
+    if (!m || (tok->flags & TF_NOEXPAND))
+        return false;
+
+    if (hideset_contains(item->hideset, tok->sym))
+    {
+        tok->flags |= TF_NOEXPAND;
+        return false;
+    }
+
+    if (m->handler)
+    {
+        Item result = { m->handler(tok), item->hideset };
+        ItemVec v = { &result, 1, 1 };
+        push_back(&v, tok);
+        return true;
+    }
+
+    if (m->is_objlike)
+    {
+        Hideset* hs = hideset_add(item->hideset, tok->sym);
+        ItemVec body = {};
+        for (int i = 0; i < m->body_len; ++i)
+        {
+            Item t = { m->body[i], hs };
+            t.tok.offset = tok->offset;
+            push_item(&body, t);
+        }
+        push_back(&body, tok);
+        free(body.data);
+        return true;
+    }
+
+    // the name of a function-like macro not followed by '(' is not expanded
+    if (!peek_is('('))
+        return false;
+
+    Frame* frame;
+    read_item(&frame);
+    Item rparen;
+    ItemVec* args = read_macro_args(m, tok, &rparen);
+
+    Hideset* hs = hideset_intersection(item->hideset, rparen.hideset);
+    hs = hideset_add(hs, tok->sym);
+
+    ItemVec body = subst(m, args, tok);
+    for (int i = 0; i < body.len; ++i)
+        body.data[i].hideset = body.data[i].hideset ? hideset_union(body.data[i].hideset, hs) : hs;
+    push_back(&body, tok);
+
+    free(body.data);
+    for (int i = 0; i < (m->num_params ? m->num_params : 1); ++i)
+        free(args[i].data);
+    free(args);
+    return true;
+}
+
+// `#define` name replacement-list
+// `#define` name(params) replacement-list
+static void read_macro_definition(Token* tok, Token* end)
+{
+    if (tok == end || tok->kind != TK_IDENT)
+        error_tok(tok == end ? tok - 1 : tok, "macro name must be an identifier");
+    int sym = tok->sym;
+    ++tok;
+
+    // a function-like macro has '(' right after its name
+    if (tok < end && equal(tok, '(') && !(tok->flags & TF_SPACE))
+    {
+        Macro* m = add_macro(sym, false);
+        ++tok;
+        int capacity = 0;
+        while (!equal(tok, ')'))
+        {
+            if (m->num_params && !equal(tok++, ','))
+                error_tok(tok - 1, "expected ','");
+            if (tok == end || tok->kind != TK_IDENT)
+                error_tok(tok == end ? tok - 1 : tok, "expected a parameter name");
+            if (m->num_params == capacity)
+            {
+                capacity = capacity ? capacity * 2 : 4;
+                m->params = realloc(m->params, sizeof(int) * capacity);
+            }
+            m->params[m->num_params++] = tok->sym;
+            if (++tok == end)
+                error_tok(tok - 1, "expected ')'");
+        }
+        m->body = tok + 1;
+        m->body_len = end - (tok + 1);
+        return;
+    }
+
+    Macro* m = add_macro(sym, true);
+    m->body = tok;
+    m->body_len = end - tok;
+}
+
+// constant expression of #if
+// the expression has been macro-expanded; remaining identifiers are 0
+// the lexer has no two-character "&&", "||", "<<" and ">>", so those are
+// recognized as two adjacent characters
+static int64_t eval_ternary(Token** rest, Token* tok);
+
+static bool is_pair(Token* tok, int id)
+{
+    return equal(tok, id) && equal(tok + 1, id) && !(tok[1].flags & TF_SPACE);
+}
+
+static int64_t eval_primary(Token** rest, Token* tok)
+{
+    if (equal(tok, '('))
+    {
+        int64_t val = eval_ternary(&tok, tok + 1);
+        *rest = skip(tok, ')');
+        return val;
+    }
+    if (tok->kind == TK_NUM)
+    {
+        *rest = tok + 1;
+        return get_literal(tok)->val;
+    }
+    if (tok->kind == TK_IDENT || tok->kind == TK_KEYWORD)
+    {
+        *rest = tok + 1;
+        return 0;
+    }
+    error_tok(tok, "invalid expression");
+    return 0;
+}
+
+static int64_t eval_unary(Token** rest, Token* tok)
+{
+    if (equal(tok, '+'))
+        return eval_unary(rest, tok + 1);
+    if (equal(tok, '-'))
+        return -eval_unary(rest, tok + 1);
+    if (equal(tok, '!'))
+        return !eval_unary(rest, tok + 1);
+    if (equal(tok, '~'))
+        return ~eval_unary(rest, tok + 1);
+    return eval_primary(rest, tok);
+}
+
+static int64_t eval_mul(Token** rest, Token* tok)
+{
+    int64_t val = eval_unary(&tok, tok);
+    for (;;)
+    {
+        Token* start = tok;
+        if (equal(tok, '*'))
+            val *= eval_unary(&tok, tok + 1);
+        else if (equal(tok, '/') || equal(tok, '%'))
+        {
+            int64_t rhs = eval_unary(&tok, tok + 1);
+            if (rhs == 0 && !cc->pp->unevaluated)
+                error_tok(start, "division by zero");
+            if (rhs != 0)
+                val = equal(start, '/') ? val / rhs : val % rhs;
+        }
+        else
+            break;
+    }
+    *rest = tok;
+    return val;
+}
+
+static int64_t eval_add(Token** rest, Token* tok)
+{
+    int64_t val = eval_mul(&tok, tok);
+    for (;;)
+    {
+        if (equal(tok, '+'))
+            val += eval_mul(&tok, tok + 1);
+        else if (equal(tok, '-'))
+            val -= eval_mul(&tok, tok + 1);
+        else
+            break;
+    }
+    *rest = tok;
+    return val;
+}
+
+static int64_t eval_shift(Token** rest, Token* tok)
+{
+    int64_t val = eval_add(&tok, tok);
+    for (;;)
+    {
+        if (is_pair(tok, '<'))
+            val <<= eval_add(&tok, tok + 2);
+        else if (is_pair(tok, '>'))
+            val >>= eval_add(&tok, tok + 2);
+        else
+            break;
+    }
+    *rest = tok;
+    return val;
+}
+
+static int64_t eval_relational(Token** rest, Token* tok)
+{
+    int64_t val = eval_shift(&tok, tok);
+    for (;;)
+    {
+        if (equal(tok, '<') && !is_pair(tok, '<'))
+            val = val < eval_shift(&tok, tok + 1);
+        else if (equal(tok, PU_LE))
+            val = val <= eval_shift(&tok, tok + 1);
+        else if (equal(tok, '>') && !is_pair(tok, '>'))
+            val = val > eval_shift(&tok, tok + 1);
+        else if (equal(tok, PU_GE))
+            val = val >= eval_shift(&tok, tok + 1);
+        else
+            break;
+    }
+    *rest = tok;
+    return val;
+}
+
+static int64_t eval_equality(Token** rest, Token* tok)
+{
+    int64_t val = eval_relational(&tok, tok);
+    for (;;)
+    {
+        if (equal(tok, PU_EQ))
+            val = val == eval_relational(&tok, tok + 1);
+        else if (equal(tok, PU_NE))
+            val = val != eval_relational(&tok, tok + 1);
+        else
+            break;
+    }
+    *rest = tok;
+    return val;
+}
+
+static int64_t eval_bitand(Token** rest, Token* tok)
+{
+    int64_t val = eval_equality(&tok, tok);
+    while (equal(tok, '&') && !is_pair(tok, '&'))
+        val &= eval_equality(&tok, tok + 1);
+    *rest = tok;
+    return val;
+}
+
+static int64_t eval_bitxor(Token** rest, Token* tok)
+{
+    int64_t val = eval_bitand(&tok, tok);
+    while (equal(tok, '^'))
+        val ^= eval_bitand(&tok, tok + 1);
+    *rest = tok;
+    return val;
+}
+
+static int64_t eval_bitor(Token** rest, Token* tok)
+{
+    int64_t val = eval_bitxor(&tok, tok);
+    while (equal(tok, '|') && !is_pair(tok, '|'))
+        val |= eval_bitxor(&tok, tok + 1);
+    *rest = tok;
+    return val;
+}
+
+static int64_t eval_logand(Token** rest, Token* tok)
+{
+    Preprocessor* pp = cc->pp;
+    int64_t val = eval_bitor(&tok, tok);
+    while (is_pair(tok, '&'))
+    {
+        pp->unevaluated += !val;
+        int64_t rhs = eval_bitor(&tok, tok + 2);
+        pp->unevaluated -= !val;
+        val = val && rhs;
+    }
+    *rest = tok;
+    return val;
+}
+
+static int64_t eval_logor(Token** rest, Token* tok)
+{
+    Preprocessor* pp = cc->pp;
+    int64_t val = eval_logand(&tok, tok);
+    while (is_pair(tok, '|'))
+    {
+        pp->unevaluated += !!val;
+        int64_t rhs = eval_logand(&tok, tok + 2);
+        pp->unevaluated -= !!val;
+        val = val || rhs;
+    }
+    *rest = tok;
+    return val;
+}
+
+static int64_t eval_ternary(Token** rest, Token* tok)
+{
+    Preprocessor* pp = cc->pp;
+    int64_t cond = eval_logor(&tok, tok);
+    if (!equal(tok, '?'))
+    {
+        *rest = tok;
+        return cond;
+    }
+    pp->unevaluated += !cond;
+    int64_t then = eval_ternary(&tok, tok + 1);
+    pp->unevaluated += !!cond - !cond;
+    int64_t els = eval_ternary(&tok, skip(tok, ':'));
+    pp->unevaluated -= !!cond;
+    *rest = tok;
+    return cond ? then : els;
+}
+
+// evaluates the operand of #if or #elif in [tok, end)
+static bool eval_const_expr(Token* directive, Token* tok, Token* end)
+{
+    if (tok == end)
+        error_tok(directive, "no expression");
+
+    // "defined" is resolved before the macros are expanded
+    ItemVec items = {};
+    for (; tok < end; ++tok)
+    {
+        if (!is_name(tok, cc->pp->names.defined))
+        {
+            push_item(&items, (Item) { *tok, NULL });
+            continue;
+        }
+
+        Token* start = tok++;
+        bool has_paren = tok < end && equal(tok, '(');
+        if (has_paren)
+            ++tok;
+        if (tok == end || tok->kind != TK_IDENT)
+            error_tok(start, "macro name must be an identifier");
+        bool defined = find_macro(tok);
+        if (has_paren && (++tok == end || !equal(tok, ')')))
+            error_tok(start, "expected ')'");
+        push_item(&items, (Item) { new_num_token(defined, start), NULL });
+    }
+
+    ItemVec expanded = expand_items(&items);
+    Token* expr = malloc(sizeof(Token) * (expanded.len + 1));
+    for (int i = 0; i < expanded.len; ++i)
+        expr[i] = expanded.data[i].tok;
+    expr[expanded.len] = eof_token;
+    expr[expanded.len].offset = end[-1].offset;
+
+    Token* rest;
+    int64_t val = eval_ternary(&rest, expr);
+    if (rest->kind != TK_EOF)
+        error_tok(rest, "extra token");
+
+    free(items.data);
+    free(expanded.data);
+    free(expr);
+    return val;
+}
+
+static void push_cond(Token* tok, bool included)
+{
+    Preprocessor* pp = cc->pp;
+    if (pp->num_conds == pp->cond_capacity)
+    {
+        pp->cond_capacity = pp->cond_capacity ? pp->cond_capacity * 2 : 16;
+        pp->conds = realloc(pp->conds, sizeof(CondIncl) * pp->cond_capacity);
+    }
+    pp->conds[pp->num_conds++] = (CondIncl) { tok, IN_THEN, included };
+}
+
+// skips the tokens of a group whose condition is false, up to the #elif,
+// #else or #endif that ends it; returns false if the input ends first
+static bool skip_cond_incl(void)
+{
+    Preprocessor* pp = cc->pp;
+    Frame* f = current_frame();
+    Token* tok = f->tok;
+    for (; tok->kind != TK_EOF; ++tok)
+    {
+        if (!is_hash(tok) || (tok[1].flags & TF_BOL))
+            continue;
+
+        Token* name = tok + 1;
+        if (equal(name, KW_IF) || is_name(name, pp->names.ifdef) || is_name(name, pp->names.ifndef))
+            ++pp->skip_depth;
+        else if (is_name(name, pp->names.endif) && pp->skip_depth > 0)
+            --pp->skip_depth;
+        else if (pp->skip_depth == 0 && (is_name(name, pp->names.elif) || equal(name, KW_ELSE) || is_name(name, pp->names.endif)))
+        {
+            f->tok = tok;
+            pp->skipping = false;
+            return true;
+        }
+    }
+
+    f->tok = tok;
+    if (pp->num_frames > 1)
+        error_tok(pp->conds[pp->num_conds - 1].tok, "unterminated conditional directive");
+    return false;
+}
+
+static void start_skipping(void)
+{
+    Preprocessor* pp = cc->pp;
+    pp->skipping = true;
+    pp->skip_depth = 0;
+}
+
+void add_include_path(char* dir)
+{
+    Preprocessor* pp = cc->pp;
+    pp->include_paths = realloc(pp->include_paths, sizeof(char*) * (pp->num_include_paths + 1));
+    pp->include_paths[pp->num_include_paths++] = strdup(dir);
+}
+
+void clear_include_paths(void)
+{
+    Preprocessor* pp = cc->pp;
+    for (int i = 0; i < pp->num_include_paths; ++i)
+        free(pp->include_paths[i]);
+    pp->num_include_paths = 0;
+}
+
+// returns the file number of the file included by `#include "name"` from the
+// file includer (or by `#include <name>` if includer is 0), or -1
+// the result is cached since the same header is typically included many times
+// the paths searched before the file is found are recorded as missing deps
+static int resolve_include(char* name, int includer)
+{
+    Preprocessor* pp = cc->pp;
+    char* key = format("%d:%s", includer, name);
+    int sym = intern(key, strlen(key));
+    free(key);
+    if (sym < pp->include_cache_capacity && pp->include_cache[sym])
+        return pp->include_cache[sym];
+
+    int file_no = -1;
+    if (name[0] == '/')
+        file_no = load_source_file(name);
+    else
+    {
+        // a quoted name is searched first in the directory of the includer
+        if (includer)
+        {
+            char* dir = strdup(source_file_name(includer));
+            char* path = format("%s/%s", dirname(dir), name);
+            file_no = load_source_file(path);
+            if (file_no < 0)
+                add_missing_dep(path);
+            free(path);
+            free(dir);
+        }
+        for (int i = 0; i < pp->num_include_paths && file_no < 0; ++i)
+        {
+            char* path = format("%s/%s", pp->include_paths[i], name);
+            file_no = load_source_file(path);
+            if (file_no < 0)
+                add_missing_dep(path);
+            free(path);
+        }
+    }
+
+    if (sym >= pp->include_cache_capacity)
+    {
+        int capacity = pp->include_cache_capacity ? pp->include_cache_capacity : 256;
+        while (capacity <= sym)
+            capacity *= 2;
+        pp->include_cache = realloc(pp->include_cache, sizeof(int) * capacity);
+        memset(pp->include_cache + pp->include_cache_capacity, 0, sizeof(int) * (capacity - pp->include_cache_capacity));
+        pp->include_cache_capacity = capacity;
+    }
+    pp->include_cache[sym] = file_no;
+    return file_no;
+}
+
+// returns the symbol of the include guard macro if the file has the form
+//   #ifndef X
+//   ...
+//   #endif
+// with nothing outside the conditional and no #elif or #else in it, or -1
+static int find_include_guard(Token* tok)
+{
+    Preprocessor* pp = cc->pp;
+    if (!is_hash(tok) || !is_name(tok + 1, pp->names.ifndef) || tok[2].kind != TK_IDENT || !(tok[3].flags & TF_BOL))
+        return -1;
+    int guard = tok[2].sym;
+
+    int depth = 0;
+    for (tok = tok + 3; tok->kind != TK_EOF; ++tok)
+    {
+        if (!is_hash(tok) || (tok[1].flags & TF_BOL))
+            continue;
+
+        Token* name = tok + 1;
+        if (equal(name, KW_IF) || is_name(name, pp->names.ifdef) || is_name(name, pp->names.ifndef))
+            ++depth;
+        else if (depth == 0 && (is_name(name, pp->names.elif) || equal(name, KW_ELSE)))
+            return -1;
+        else if (is_name(name, pp->names.endif) && depth-- == 0)
+            return skip_line(name)->kind == TK_EOF ? guard : -1;
+    }
+    return -1;
+}
+
+// the operand of #include: "name", <name> or macros expanding to either
+// *is_quoted is set for the "name" form; the caller frees the name
+static char* read_include_name(Token* tok, Token* end, bool* is_quoted)
+{
+    if (tok < end && tok->kind == TK_STR)
+    {
+        if (tok + 1 != end)
+            error_tok(tok + 1, "extra token");
+        *is_quoted = true;
+        return strdup(get_literal(tok)->str);
+    }
+
+    // <name> is spelled as in the source, which is not a sequence of tokens
+    if (tok < end && equal(tok, '<') && token_loc(tok))
+    {
+        Token* close = tok;
+        while (close < end && !equal(close, '>'))
+            ++close;
+        if (close == end)
+            error_tok(tok, "expected '>'");
+        if (close + 1 != end)
+            error_tok(close + 1, "extra token");
+        *is_quoted = false;
+        char* start = token_loc(tok) + 1;
+        return strndup(start, token_loc(close) - start);
+    }
+
+    if (tok == end)
+        error_tok(tok - 1, "expected a filename");
+
+    ItemVec items = {};
+    for (Token* t = tok; t < end; ++t)
+        push_item(&items, (Item) { *t, NULL });
+    ItemVec expanded = expand_items(&items);
+    free(items.data);
+
+    if (expanded.len == 1 && expanded.data[0].tok.kind == TK_STR)
+    {
+        *is_quoted = true;
+        char* name = strdup(get_literal(&expanded.data[0].tok)->str);
+        free(expanded.data);
+        return name;
+    }
+    if (expanded.len >= 2 && equal(&expanded.data[0].tok, '<') && equal(&expanded.data[expanded.len - 1].tok, '>'))
+    {
+        ItemVec inner = { expanded.data + 1, expanded.len - 2, expanded.len - 2 };
+        *is_quoted = false;
+        char* name = join_tokens(&inner);
+        free(expanded.data);
+        return name;
+    }
+    free(expanded.data);
+    error_tok(tok, "expected a filename");
+    return NULL;
+}
+
+static void include_file(Token* tok, Token* end, int includer)
+{
+    Preprocessor* pp = cc->pp;
+    bool is_quoted;
+    char* name = read_include_name(tok, end, &is_quoted);
+    int file_no = resolve_include(name, is_quoted ? includer : 0);
+    if (file_no < 0)
+    {
+        // error_tok() does not return, so name is freed before it
+        char text[256];
+        snprintf(text, sizeof(text), "%s", name);
+        free(name);
+        error_tok(tok, "%s: cannot open file", text);
+    }
+    free(name);
+
+    // a file guarded against multiple inclusion is not read again
+    FileInfo* info = get_file_info(file_no);
+    if (info->included && info->pragma_once)
+        return;
+    if (info->guard_checked && info->guard >= 0 && info->guard < pp->macro_capacity && pp->macros[info->guard])
+        return;
+
+    Token* tokens = file_tokens(file_no);
+    info = get_file_info(file_no);
+    if (!info->guard_checked)
+    {
+        info->guard = find_include_guard(tokens);
+        info->guard_checked = true;
+    }
+    info->included = true;
+
+    if (pp->num_frames == pp->frame_capacity)
+    {
+        pp->frame_capacity *= 2;
+        pp->frames = realloc(pp->frames, sizeof(Frame) * pp->frame_capacity);
+    }
+    pp->frames[pp->num_frames++] = (Frame) { tokens, file_no, pp->num_conds };
+}
+
+// executes the directive starting at the '#' token
+static void directive(Frame* f, Token* hash)
+{
+    Preprocessor* pp = cc->pp;
+    Token* tok = hash + 1;
+    Token* end = skip_line(tok);
+    f->tok = end;
+
+    // null directive
+    if (tok->kind == TK_EOF || (tok->flags & TF_BOL))
+    {
+        f->tok = tok;
+        return;
+    }
+
+    int file_no = f->file_no ? f->file_no : file_number(tok);
+
+    if (is_name(tok, pp->names.include))
+    {
+        include_file(tok + 1, end, file_no);
+        return;
+    }
+
+    if (is_name(tok, pp->names.define))
+    {
+        read_macro_definition(tok + 1, end);
+        return;
+    }
+
+    if (is_name(tok, pp->names.undef))
+    {
+        if (tok + 1 == end || tok[1].kind != TK_IDENT)
+            error_tok(tok, "macro name must be an identifier");
+        if (tok + 2 != end)
+            error_tok(tok + 2, "extra token");
+        if (find_macro(tok + 1))
+        {
+            free_macro(pp->macros[tok[1].sym]);
+            pp->macros[tok[1].sym] = NULL;
+        }
+        return;
+    }
+
+    if (equal(tok, KW_IF))
+    {
+        bool val = eval_const_expr(tok, tok + 1, end);
+        push_cond(tok, val);
+        if (!val)
+            start_skipping();
+        return;
+    }
+
+    if (is_name(tok, pp->names.ifdef) || is_name(tok, pp->names.ifndef))
+    {
+        if (tok + 1 == end || tok[1].kind != TK_IDENT)
+            error_tok(tok, "macro name must be an identifier");
+        bool val = find_macro(tok + 1) ? is_name(tok, pp->names.ifdef) : is_name(tok, pp->names.ifndef);
+        push_cond(tok, val);
+        if (!val)
+            start_skipping();
+        return;
+    }
+
+    if (is_name(tok, pp->names.elif))
+    {
+        if (pp->num_conds == 0 || pp->conds[pp->num_conds - 1].ctx == IN_ELSE)
+            error_tok(tok, "stray #elif");
+        CondIncl* c = &pp->conds[pp->num_conds - 1];
+        c->ctx = IN_ELIF;
+        if (!c->included && eval_const_expr(tok, tok + 1, end))
+            c->included = true;
+        else
+            start_skipping();
+        return;
+    }
+
+    if (equal(tok, KW_ELSE))
+    {
+        if (pp->num_conds == 0 || pp->conds[pp->num_conds - 1].ctx == IN_ELSE)
+            error_tok(tok, "stray #else");
+        CondIncl* c = &pp->conds[pp->num_conds - 1];
+        c->ctx = IN_ELSE;
+        if (c->included)
+            start_skipping();
+        c->included = true;
+        return;
+    }
+
+    if (is_name(tok, pp->names.endif))
+    {
+        if (pp->num_conds == 0 || (f->file_no && pp->num_conds == f->cond_depth))
+            error_tok(tok, "stray #endif");
+        --pp->num_conds;
+        return;
+    }
+
+    if (is_name(tok, pp->names.pragma))
+    {
+        // other pragmas are ignored
+        if (tok + 1 < end && is_name(tok + 1, pp->names.once))
+            get_file_info(file_no)->pragma_once = true;
+        return;
+    }
+
+    if (is_name(tok, pp->names.error))
+        error_tok(tok, "error");
+
+    // line markers are of no use to the compiler
+    if (is_name(tok, pp->names.line))
+        return;
+
+    error_tok(tok, "invalid preprocessor directive");
+}
+
+// appends the expansion of the input to out, or to the result of preprocess()
+// if out is NULL, until a TK_EOF is read
+
+static void emit(ItemVec* out, Item* item)
+{
+    Preprocessor* pp = cc->pp;
+    if (out)
+    {
+        push_item(out, *item);
+        return;
+    }
+
+    if (pp->result_len == pp->result_capacity)
+    {
+        pp->result_capacity = pp->result_capacity ? pp->result_capacity * 2 : 4096;
+        pp->result = realloc(pp->result, sizeof(Token) * pp->result_capacity);
+    }
+    pp->result[pp->result_len++] = item->tok;
+}
+
+static void expand(ItemVec* out)
+{
+    for (;;)
+    {
+        if (cc->pp->skipping && !skip_cond_incl())
+            return;
+
+        Frame* frame;
+        Item item = read_item(&frame);
+        if (item.tok.kind == TK_EOF)
+            return;
+
+        if (frame && is_hash(&item.tok))
+        {
+            directive(frame, frame->tok - 1);
+            continue;
+        }
+
+        if (expand_macro(&item))
+            continue;
+        emit(out, &item);
+    }
+}
+
+static Token file_macro(Token* tok)
+{
+    return new_str_token(source_file_name(file_number(tok)), tok);
+}
+
+static Token line_macro(Token* tok)
+{
+    return new_num_token(line_number(tok), tok);
+}
+
+static void add_builtin(char* name, Token (*handler)(Token* tok))
+{
+    add_macro(intern(name, strlen(name)), true)->handler = handler;
+}
+
+// called at the start of every chunk; sets up a new translation unit
+static void init_macros(void)
+{
+    Preprocessor* pp = cc->pp;
+    if (pp->active)
+        return;
+    pp->active = true;
+
+    pp->names.define = intern("define", 6);
+    pp->names.undef = intern("undef", 5);
+    pp->names.include = intern("include", 7);
+    pp->names.ifdef = intern("ifdef", 5);
+    pp->names.ifndef = intern("ifndef", 6);
+    pp->names.elif = intern("elif", 4);
+    pp->names.endif = intern("endif", 5);
+    pp->names.error = intern("error", 5);
+    pp->names.pragma = intern("pragma", 6);
+    pp->names.line = intern("line", 4);
+    pp->names.once = intern("once", 4);
+    pp->names.defined = intern("defined", 7);
+
+    add_builtin("__FILE__", file_macro);
+    add_builtin("__LINE__", line_macro);
+}
+
+static void push_output(Token* tok)
+{
+    Preprocessor* pp = cc->pp;
+    if (pp->num_outputs == pp->output_capacity)
+    {
+        pp->output_capacity = pp->output_capacity ? pp->output_capacity * 2 : 16;
+        pp->outputs = realloc(pp->outputs, sizeof(Token*) * pp->output_capacity);
+    }
+    pp->outputs[pp->num_outputs++] = tok;
+}
+
+// preprocesses a token array of the main file: the whole file, or the next
+// chunk of a streamed one (see tokenize_more()). directives and conditionals
+// may continue from one chunk into the next, so chunks that preprocess to
+// nothing are passed over; a lone TK_EOF marks the end of the main file
+Token* preprocess(Token* tok)
+{
+    Preprocessor* pp = cc->pp;
+    init_macros();
+
+    for (;;)
+    {
+        bool is_end = tok->kind == TK_EOF;
+        if (is_end && pp->num_conds)
+            error_tok(pp->conds[pp->num_conds - 1].tok, "unterminated conditional directive");
+
+        pp->result = NULL;
+        pp->result_len = 0;
+        pp->result_capacity = 0;
+
+        pp->frames[0] = (Frame) { tok, 0, 0 };
+        pp->num_frames = 1;
+        expand(NULL);
+
+        Item eof = { *current_frame()->tok, NULL };
+        emit(NULL, &eof);
+        if (pp->result_len > 1 || is_end)
+        {
+            push_output(pp->result);
+            return pp->result;
+        }
+
+        free(pp->result);
+        tok = tokenize_more();
+    }
+}
+
+Preprocessor* new_preprocessor(void)
+{
+    Preprocessor* pp = calloc(1, sizeof(Preprocessor));
+    pp->frame_capacity = 16;
+    pp->frames = malloc(sizeof(Frame) * pp->frame_capacity);
+    return pp;
+}
+
+// ends the translation unit: its macros, conditionals, included files and
+// output are released; the include paths are kept for the next one
+void reset_preprocessor(void)
+{
+    Preprocessor* pp = cc->pp;
+    for (int i = 0; i < pp->macro_capacity; ++i)
+    {
+        free_macro(pp->macros[i]);
+        pp->macros[i] = NULL;
+    }
+    for (int i = 0; i < pp->num_outputs; ++i)
+        free(pp->outputs[i]);
+    pp->num_outputs = 0;
+    region_reset(&pp->hidesets);
+
+    if (pp->file_info)
+        memset(pp->file_info, 0, sizeof(FileInfo) * pp->file_info_capacity);
+    if (pp->include_cache)
+        memset(pp->include_cache, 0, sizeof(int) * pp->include_cache_capacity);
+
+    pp->num_conds = 0;
+    pp->num_frames = 0;
+    pp->pending.len = 0;
+    pp->skipping = false;
+    pp->skip_depth = 0;
+    pp->unevaluated = 0;
+    pp->active = false;
+}
+
+void free_preprocessor(Preprocessor* pp)
+{
+    free(pp->macros);
+    free(pp->conds);
+    free(pp->frames);
+    free(pp->pending.data);
+    free(pp->file_info);
+    free(pp->include_cache);
+    free(pp->outputs);
+    region_free(&pp->hidesets);
+    for (int i = 0; i < pp->num_include_paths; ++i)
+        free(pp->include_paths[i]);
+    free(pp->include_paths);
+    free(pp);
+}
@@ -0,0 +1,87 @@
+// bump-pointer regions
+// the objects of a translation unit (nodes, types, scopes, ...) live exactly
+// as long as the unit, so rather than being allocated and freed one by one,
+// they are carved out of large zeroed blocks and released all at once when
+// the unit is done; the blocks are kept and reused by the next unit, so
+// compiling many units does not grow the heap beyond the largest one
+
+#include "au_cc.h"
+
+enum { REGION_BLOCK_SIZE = 256 * 1024 };
+
+struct RegionBlock
+{
+    RegionBlock* next;
+    size_t size;
+    _Alignas(max_align_t) char data[];
+};
+
+// called by region_alloc() once the current block is exhausted
+void* region_grow(Region* r, size_t size)
+{
+    // large objects (ex: the initializer of a big global array) get a block
+    // of their own instead of wasting the rest of a shared one
+    if (size > REGION_BLOCK_SIZE / 4)
+    {
+        RegionBlock* b = calloc(1, sizeof(RegionBlock) + size);
+        b->size = size;
+        b->next = r->large;
+        r->large = b;
+        return b->data;
+    }
+
+    // reuse the blocks of an earlier unit before allocating new ones
+    RegionBlock* b = r->block ? r->block->next : r->first;
+    if (!b)
+    {
+        b = calloc(1, sizeof(RegionBlock) + REGION_BLOCK_SIZE);
+        b->size = REGION_BLOCK_SIZE;
+        if (r->block)
+            r->block->next = b;
+        else
+            r->first = b;
+    }
+
+    r->block = b;
+    r->cur = b->data + size;
+    r->end = b->data + b->size;
+    return b->data;
+}
+
+// releases every object of r; the memory of r is zeroed for reuse
+void region_reset(Region* r)
+{
+    for (RegionBlock* b = r->first; b && r->block; b = b->next)
+    {
+        if (b == r->block)
+        {
+            memset(b->data, 0, r->cur - b->data);
+            break;
+        }
+        memset(b->data, 0, b->size);
+    }
+
+    for (RegionBlock* b = r->large; b;)
+    {
+        RegionBlock* next = b->next;
+        free(b);
+        b = next;
+    }
+
+    r->large = NULL;
+    r->block = NULL;
+    r->cur = r->end = NULL;
+}
+
+// releases every object of r and the memory of r
+void region_free(Region* r)
+{
+    region_reset(r);
+    for (RegionBlock* b = r->first; b;)
+    {
+        RegionBlock* next = b->next;
+        free(b);
+        b = next;
+    }
+    r->first = NULL;
+}
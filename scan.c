@@ -0,0 +1,250 @@
+// byte scanning kernels used by the lexer for its hot loops
+// each kernel has a scalar version and, on x86-64, SSE2 and AVX2 versions
+// selected at runtime: SSE2 by default, scalar in builds with AddressSanitizer,
+// or those named by the AU_CC_SCAN environment variable (scalar, sse2 or avx2)
+//
+// the vector versions only issue aligned loads: an aligned 16/32-byte load
+// never crosses a page boundary, so reading a few bytes past the '\0' that
+// terminates the input can not fault even when the input ends a mapping
+// bytes before the start pointer are masked off after the first load
+
+#include "au_cc.h"
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+#endif
+
+// ' ', '\t', '\v', '\f' and '\r'; '\n' is handled by the lexer to record line starts
+static bool is_blank(char c)
+{
+    return c == ' ' || c == '\t' || c == '\v' || c == '\f' || c == '\r';
+}
+
+static bool is_ident_char(char c)
+{
+    return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || ('0' <= c && c <= '9') || c == '_';
+}
+
+static char* skip_blank_scalar(char* p)
+{
+    while (is_blank(*p))
+        ++p;
+    return p;
+}
+
+static char* ident_end_scalar(char* p)
+{
+    while (is_ident_char(*p))
+        ++p;
+    return p;
+}
+
+static char* find_any_scalar(char* p, char a, char b, char c)
+{
+    while (*p && *p != a && *p != b && *p != c)
+        ++p;
+    return p;
+}
+
+#if defined(__x86_64__)
+
+// SSE2 has no unsigned byte compare; x is in [lo, hi] iff min(x - lo, hi - lo) == x - lo
+#define IN_RANGE_128(x, lo, hi) \
+    _mm_cmpeq_epi8(_mm_min_epu8(_mm_sub_epi8(x, _mm_set1_epi8(lo)), _mm_set1_epi8((hi) - (lo))), _mm_sub_epi8(x, _mm_set1_epi8(lo)))
+
+#define IN_RANGE_256(x, lo, hi) \
+    _mm256_cmpeq_epi8(_mm256_min_epu8(_mm256_sub_epi8(x, _mm256_set1_epi8(lo)), _mm256_set1_epi8((hi) - (lo))), _mm256_sub_epi8(x, _mm256_set1_epi8(lo)))
+
+static __m128i blank_mask_128(__m128i x)
+{
+    // '\t', '\v', '\f' and '\r' are 9, 11, 12 and 13; '\n' (10) is excluded
+    __m128i m = IN_RANGE_128(x, '\t', '\r');
+    m = _mm_andnot_si128(_mm_cmpeq_epi8(x, _mm_set1_epi8('\n')), m);
+    return _mm_or_si128(m, _mm_cmpeq_epi8(x, _mm_set1_epi8(' ')));
+}
+
+static __m128i ident_mask_128(__m128i x)
+{
+    __m128i lower = _mm_or_si128(x, _mm_set1_epi8(0x20)); // folds 'A'-'Z' into 'a'-'z'
+    __m128i m = IN_RANGE_128(lower, 'a', 'z');
+    m = _mm_or_si128(m, IN_RANGE_128(x, '0', '9'));
+    return _mm_or_si128(m, _mm_cmpeq_epi8(x, _mm_set1_epi8('_')));
+}
+
+// returns the first byte at or after p that is not in the class computed by mask_fn
+#define SCAN_WHILE_128(p, mask_fn)                                                \
+    do                                                                            \
+    {                                                                             \
+        uintptr_t mis = (uintptr_t)(p) & 15;                                      \
+        char* q = (p) - mis;                                                      \
+        for (unsigned keep = (0xFFFFu << mis) & 0xFFFF;; keep = 0xFFFF, q += 16)  \
+        {                                                                         \
+            unsigned in = _mm_movemask_epi8(mask_fn(_mm_load_si128((__m128i*)q))); \
+            unsigned bits = ~in & keep;                                           \
+            if (bits)                                                             \
+                return q + __builtin_ctz(bits);                                   \
+        }                                                                         \
+    } while (0)
+
+static char* skip_blank_sse2(char* p)
+{
+    SCAN_WHILE_128(p, blank_mask_128);
+}
+
+static char* ident_end_sse2(char* p)
+{
+    SCAN_WHILE_128(p, ident_mask_128);
+}
+
+static char* find_any_sse2(char* p, char a, char b, char c)
+{
+    __m128i va = _mm_set1_epi8(a);
+    __m128i vb = _mm_set1_epi8(b);
+    __m128i vc = _mm_set1_epi8(c);
+    __m128i zero = _mm_setzero_si128();
+
+    uintptr_t mis = (uintptr_t)p & 15;
+    char* q = p - mis;
+    for (unsigned keep = 0xFFFFu << mis;; keep = 0xFFFF, q += 16)
+    {
+        __m128i x = _mm_load_si128((__m128i*)q);
+        __m128i m = _mm_or_si128(_mm_cmpeq_epi8(x, va), _mm_cmpeq_epi8(x, vb));
+        m = _mm_or_si128(m, _mm_or_si128(_mm_cmpeq_epi8(x, vc), _mm_cmpeq_epi8(x, zero)));
+        unsigned bits = _mm_movemask_epi8(m) & keep;
+        if (bits)
+            return q + __builtin_ctz(bits);
+    }
+}
+
+__attribute__((target("avx2"))) static __m256i blank_mask_256(__m256i x)
+{
+    __m256i m = IN_RANGE_256(x, '\t', '\r');
+    m = _mm256_andnot_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8('\n')), m);
+    return _mm256_or_si256(m, _mm256_cmpeq_epi8(x, _mm256_set1_epi8(' ')));
+}
+
+__attribute__((target("avx2"))) static __m256i ident_mask_256(__m256i x)
+{
+    __m256i lower = _mm256_or_si256(x, _mm256_set1_epi8(0x20));
+    __m256i m = IN_RANGE_256(lower, 'a', 'z');
+    m = _mm256_or_si256(m, IN_RANGE_256(x, '0', '9'));
+    return _mm256_or_si256(m, _mm256_cmpeq_epi8(x, _mm256_set1_epi8('_')));
+}
+
+#define SCAN_WHILE_256(p, mask_fn)                                                      \
+    do                                                                                  \
+    {                                                                                   \
+        uintptr_t mis = (uintptr_t)(p) & 31;                                            \
+        char* q = (p) - mis;                                                            \
+        for (uint32_t keep = 0xFFFFFFFFu << mis;; keep = 0xFFFFFFFFu, q += 32)          \
+        {                                                                               \
+            uint32_t in = _mm256_movemask_epi8(mask_fn(_mm256_load_si256((__m256i*)q))); \
+            uint32_t bits = ~in & keep;                                                 \
+            if (bits)                                                                   \
+                return q + __builtin_ctz(bits);                                         \
+        }                                                                               \
+    } while (0)
+
+__attribute__((target("avx2"))) static char* skip_blank_avx2(char* p)
+{
+    SCAN_WHILE_256(p, blank_mask_256);
+}
+
+__attribute__((target("avx2"))) static char* ident_end_avx2(char* p)
+{
+    SCAN_WHILE_256(p, ident_mask_256);
+}
+
+__attribute__((target("avx2"))) static char* find_any_avx2(char* p, char a, char b, char c)
+{
+    __m256i va = _mm256_set1_epi8(a);
+    __m256i vb = _mm256_set1_epi8(b);
+    __m256i vc = _mm256_set1_epi8(c);
+    __m256i zero = _mm256_setzero_si256();
+
+    uintptr_t mis = (uintptr_t)p & 31;
+    char* q = p - mis;
+    for (uint32_t keep = 0xFFFFFFFFu << mis;; keep = 0xFFFFFFFFu, q += 32)
+    {
+        __m256i x = _mm256_load_si256((__m256i*)q);
+        __m256i m = _mm256_or_si256(_mm256_cmpeq_epi8(x, va), _mm256_cmpeq_epi8(x, vb));
+        m = _mm256_or_si256(m, _mm256_or_si256(_mm256_cmpeq_epi8(x, vc), _mm256_cmpeq_epi8(x, zero)));
+        uint32_t bits = (uint32_t)_mm256_movemask_epi8(m) & keep;
+        if (bits)
+            return q + __builtin_ctz(bits);
+    }
+}
+
+#endif
+
+static ScanKernels kernels[] = {
+    { "scalar", skip_blank_scalar, ident_end_scalar, find_any_scalar },
+#if defined(__x86_64__)
+    { "sse2", skip_blank_sse2, ident_end_sse2, find_any_sse2 },
+    { "avx2", skip_blank_avx2, ident_end_avx2, find_any_avx2 },
+#endif
+};
+
+ScanKernels scan;
+
+static bool cpu_supports(char* name)
+{
+#if defined(__x86_64__)
+    __builtin_cpu_init();
+    if (!strcmp(name, "sse2"))
+        return __builtin_cpu_supports("sse2");
+    if (!strcmp(name, "avx2"))
+        return __builtin_cpu_supports("avx2");
+#endif
+    return !strcmp(name, "scalar");
+}
+
+// selects the kernels by name; returns false if the CPU does not support them
+bool select_scan_kernels(char* name)
+{
+    for (int i = 0; i < sizeof(kernels) / sizeof(*kernels); ++i)
+    {
+        if (!strcmp(kernels[i].name, name) && cpu_supports(name))
+        {
+            scan = kernels[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+// the vector kernels read past the end of their buffer (see above), which
+// AddressSanitizer reports as overflows of heap buffers
+#if defined(__SANITIZE_ADDRESS__)
+#define DEFAULT_KERNELS "scalar"
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define DEFAULT_KERNELS "scalar"
+#endif
+#endif
+
+// AVX2 measures no faster than SSE2 on the lexer benchmark (make bench), so
+// it is only used when asked for
+#if !defined(DEFAULT_KERNELS)
+#define DEFAULT_KERNELS "sse2"
+#endif
+
+static void select_default_kernels(void)
+{
+    if (scan.name)
+        return;
+    char* name = getenv("AU_CC_SCAN");
+    if (name && select_scan_kernels(name))
+        return;
+    if (!select_scan_kernels(DEFAULT_KERNELS))
+        select_scan_kernels("scalar");
+}
+
+// selects the kernels named by AU_CC_SCAN, or the default ones the CPU
+// supports, unless some were chosen already
+// compilers on several threads may start lexing at the same time
+void init_scan_kernels(void)
+{
+    static pthread_once_t once = PTHREAD_ONCE_INIT;
+    pthread_once(&once, select_default_kernels);
+}
@@ -0,0 +1,309 @@
+// compile server: a resident au_cc compiling the requests of clients
+// (au_cc --connect) received on a Unix domain socket
+// requests are served concurrently by a pool of threads, one per core but at
+// least MIN_WORKERS; each accepts connections and compiles with a compiler of
+// its own for the whole life of the server, so the interned names and the
+// memory of every phase stay warm from one request to the next
+// files are read afresh for each request, so edits between requests are
+// seen, and relative paths are opened from the directory of the client
+// rather than by changing the directory of the process
+//
+// a request is a sequence of fields, each a 4-byte length followed by as
+// many bytes: the working directory of the client, the input path, the
+// contents of stdin if the input is "-", the number of lexer threads, then
+// the include directories; the client then shuts down its side of the
+// connection, and the server answers with a status byte, 0 on success, then
+// the assembly, or 1 and the error messages
+
+#include "au_cc.h"
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <time.h>
+
+// how long a client may keep a worker waiting on its request or its answer
+#define CLIENT_TIMEOUT 10
+
+// a client stalled until its timeout holds up a worker, so a few are kept
+// even with fewer cores
+#define MIN_WORKERS 4
+
+// requests are held in memory whole, so larger ones are dropped unanswered
+#define MAX_REQUEST (256 << 20)
+
+// how long a worker waits before accepting again after accept() failed,
+// e.g. because the process ran out of file descriptors
+#define ACCEPT_BACKOFF_MS 100
+
+static bool write_all(int fd, char* buf, size_t len)
+{
+    while (len > 0)
+    {
+        // a peer that went away is reported as EPIPE rather than by SIGPIPE
+        ssize_t n = send(fd, buf, len, MSG_NOSIGNAL);
+        if (n < 0 && errno == EINTR)
+            continue;
+        if (n <= 0)
+            return false;
+        buf += n;
+        len -= n;
+    }
+    return true;
+}
+
+// reads fd up to the end of file into a '\0'-terminated buffer, or returns NULL
+// if reading failed or fd holds more than max bytes
+static char* read_all(int fd, size_t max, size_t* len)
+{
+    size_t capacity = 4096;
+    char* buf = malloc(capacity);
+    *len = 0;
+    for (;;)
+    {
+        if (*len + 1 == capacity)
+        {
+            capacity *= 2;
+            buf = realloc(buf, capacity);
+        }
+        ssize_t n = read(fd, buf + *len, capacity - *len - 1);
+        if (n == 0)
+            break;
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            free(buf);
+            return NULL;
+        }
+        *len += n;
+        if (*len > max)
+        {
+            free(buf);
+            return NULL;
+        }
+    }
+    buf[*len] = '\0';
+    return buf;
+}
+
+static bool write_field(int fd, char* data, size_t len)
+{
+    uint32_t n = len;
+    return write_all(fd, (char*)&n, sizeof(n)) && write_all(fd, data, len);
+}
+
+// a string field includes its terminating '\0'
+static bool write_string(int fd, char* s)
+{
+    return write_field(fd, s, strlen(s) + 1);
+}
+
+typedef struct
+{
+    char* p;
+    char* end;
+} Request;
+
+// returns the next field of req and sets *len to its size, or returns NULL
+// if req ends
+static char* next_field(Request* req, size_t* len)
+{
+    uint32_t n;
+    if ((size_t)(req->end - req->p) < sizeof(n))
+        return NULL;
+    memcpy(&n, req->p, sizeof(n));
+    if ((size_t)(req->end - req->p) - sizeof(n) < n)
+        return NULL;
+
+    char* field = req->p + sizeof(n);
+    req->p = field + n;
+    *len = n;
+    return field;
+}
+
+static char* next_string(Request* req)
+{
+    size_t len;
+    char* s = next_field(req, &len);
+    return s && len > 0 && s[len - 1] == '\0' ? s : NULL;
+}
+
+static void serve(Compiler* c, int conn)
+{
+    size_t len;
+    char* buf = read_all(conn, MAX_REQUEST, &len);
+    if (!buf)
+        return;
+
+    Request req = { buf, buf + len };
+    char* cwd = next_string(&req);
+    char* input = next_string(&req);
+    size_t src_len;
+    char* src = next_field(&req, &src_len);
+    char* lex_threads = next_string(&req);
+    if (!cwd || !input || !src || !lex_threads)
+    {
+        free(buf);
+        return;
+    }
+
+    // paths of the request are relative to the directory of the client
+    compiler_set_base_dir(c, cwd);
+    compiler_clear_include_paths(c);
+    for (char* dir; (dir = next_string(&req));)
+        compiler_add_include_path(c, dir);
+    c->lex_threads = atoi(lex_threads);
+
+    char* out = NULL;
+    size_t out_len = 0;
+    int status;
+    if (!strcmp(input, "-"))
+        status = compile_source(c, input, src, src_len, &out, &out_len);
+    else
+        status = compile_file(c, input, &out, &out_len);
+
+    char* result = status == 0 ? out : compiler_error(c);
+    size_t result_len = status == 0 ? out_len : strlen(result);
+    char code = status == 0 ? 0 : 1;
+    if (write_all(conn, &code, 1))
+        write_all(conn, result, result_len);
+
+    free(out);
+    free(buf);
+}
+
+static bool socket_address(char* path, struct sockaddr_un* addr)
+{
+    *addr = (struct sockaddr_un){ .sun_family = AF_UNIX };
+    if (strlen(path) >= sizeof(addr->sun_path))
+    {
+        errno = ENAMETOOLONG;
+        return false;
+    }
+    strcpy(addr->sun_path, path);
+    return true;
+}
+
+typedef struct
+{
+    int fd; // listening socket
+    char* path;
+} Listener;
+
+static void* serve_connections(void* arg)
+{
+    Listener* ls = arg;
+    Compiler* c = new_compiler();
+    struct timeval timeout = { .tv_sec = CLIENT_TIMEOUT };
+    for (;;)
+    {
+        int conn = accept(ls->fd, NULL, NULL);
+        if (conn < 0)
+        {
+            if (errno == EINTR || errno == ECONNABORTED)
+                continue;
+            // running out of descriptors or memory is not fatal to the server:
+            // connections are accepted again once some are released
+            fprintf(stderr, "cannot accept a connection on %s: %s\n", ls->path, strerror(errno));
+            struct timespec backoff = { .tv_nsec = ACCEPT_BACKOFF_MS * 1000000L };
+            nanosleep(&backoff, NULL);
+            continue;
+        }
+        setsockopt(conn, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        setsockopt(conn, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+        serve(c, conn);
+        close(conn);
+    }
+    return NULL;
+}
+
+// serves requests on the socket at path until the process is killed
+int run_server(char* path)
+{
+    struct sockaddr_un addr;
+    if (!socket_address(path, &addr))
+        error("cannot listen on %s: %s", path, strerror(errno));
+
+    // a socket left by a server that did not exit is replaced, but not that
+    // of a server still running
+    struct stat st;
+    if (lstat(path, &st) == 0 && S_ISSOCK(st.st_mode))
+    {
+        int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd >= 0 && connect(fd, (struct sockaddr*)&addr, sizeof(addr)) == 0)
+            error("a server is already listening on %s", path);
+        if (fd >= 0)
+            close(fd);
+        unlink(path);
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || bind(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0 || listen(fd, SOMAXCONN) != 0)
+        error("cannot listen on %s: %s", path, strerror(errno));
+
+    // the threads of the pool take turns accepting the connections
+    Listener ls = { fd, path };
+    int nthreads = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nthreads < MIN_WORKERS)
+        nthreads = MIN_WORKERS;
+    pthread_t thread;
+    for (int i = 1; i < nthreads; ++i)
+        if (pthread_create(&thread, NULL, serve_connections, &ls) != 0)
+            error("cannot create a server thread");
+    serve_connections(&ls);
+    return 0;
+}
+
+// compiles input on the server listening at path, as compile_file() would
+// on success, returns 0 and sets *out to the assembly; on error, returns -1
+// and sets *out to the messages; *out is '\0'-terminated, and freed by the caller
+int compile_remote(char* path, char** include_paths, int num_include_paths, int lex_threads,
+                   char* input, char** out, size_t* out_len)
+{
+    struct sockaddr_un addr;
+    int fd = -1;
+    if (socket_address(path, &addr))
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || connect(fd, (struct sockaddr*)&addr, sizeof(addr)) != 0)
+    {
+        *out = format("cannot connect to the server at %s: %s\n", path, strerror(errno));
+        *out_len = strlen(*out);
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
+
+    char* cwd = getcwd(NULL, 0);
+    char* src = NULL;
+    size_t src_len = 0;
+    if (!strcmp(input, "-"))
+        src = read_all(STDIN_FILENO, SIZE_MAX, &src_len);
+    char* threads = format("%d", lex_threads);
+
+    bool sent = cwd && write_string(fd, cwd) && write_string(fd, input) &&
+                write_field(fd, src ? src : "", src_len) && write_string(fd, threads);
+    for (int i = 0; i < num_include_paths && sent; ++i)
+        sent = write_string(fd, include_paths[i]);
+    shutdown(fd, SHUT_WR);
+
+    size_t len = 0;
+    char* buf = sent ? read_all(fd, SIZE_MAX, &len) : NULL;
+    close(fd);
+    free(cwd);
+    free(src);
+    free(threads);
+
+    if (!buf || len == 0)
+    {
+        free(buf);
+        *out = format("%s: the server did not answer\n", path);
+        *out_len = strlen(*out);
+        return -1;
+    }
+
+    char code = buf[0];
+    memmove(buf, buf + 1, len); // with the terminating '\0'
+    *out = buf;
+    *out_len = len - 1;
+    return code == 0 ? 0 : -1;
+}
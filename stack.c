@@ -0,0 +1,85 @@
+// segmented stacks for the recursive parts of the compiler
+// the parser and the code generator recurse once per level of nesting of the
+// input (ex: parentheses, statement expressions, blocks), so the depth they
+// reach is up to the input, not to the compiler; rather than overflowing the
+// thread's stack, a recursion that is about to run out of it continues on a
+// segment allocated from the heap, and nesting is only bounded by memory
+//
+// segments are kept once allocated, so a recursion going back and forth over
+// a segment boundary does not allocate each time
+
+#include "au_cc.h"
+#include <ucontext.h>
+
+enum
+{
+    // part of the thread's own stack used before switching to segments
+    INITIAL_STACK = 256 * 1024,
+    SEGMENT_SIZE = 1024 * 1024,
+    // enough for the frames between two checks
+    RED_ZONE = 64 * 1024,
+};
+
+typedef struct
+{
+    void (*fn)(void*);
+    void* arg;
+    ucontext_t caller;
+    ucontext_t callee;
+} StackCall;
+
+static _Thread_local char* stack_limit; // lowest usable address of the current stack
+static _Thread_local char* base_limit;  // that of the thread's own stack
+static _Thread_local char** segments;    // indexed by depth
+static _Thread_local int num_segments;
+static _Thread_local int segment_depth;  // segments in use
+static _Thread_local StackCall* current_call;
+
+// true if the caller should not recurse further on the current stack
+bool stack_is_low(void)
+{
+    char* frame = __builtin_frame_address(0);
+    if (!stack_limit)
+        stack_limit = base_limit = frame - INITIAL_STACK;
+    return frame < stack_limit + RED_ZONE;
+}
+
+static void run_call(void)
+{
+    StackCall* call = current_call;
+    call->fn(call->arg);
+}
+
+// calls fn(arg) on a new stack segment; fn returns to the caller as usual
+void call_with_stack(void (*fn)(void*), void* arg)
+{
+    if (segment_depth == num_segments)
+    {
+        segments = realloc(segments, sizeof(char*) * (num_segments + 1));
+        segments[num_segments++] = malloc(SEGMENT_SIZE);
+    }
+    char* segment = segments[segment_depth++];
+
+    StackCall call = { fn, arg };
+    getcontext(&call.callee);
+    call.callee.uc_stack.ss_sp = segment;
+    call.callee.uc_stack.ss_size = SEGMENT_SIZE;
+    call.callee.uc_link = &call.caller;
+    makecontext(&call.callee, run_call, 0);
+
+    char* saved_limit = stack_limit;
+    stack_limit = segment;
+    current_call = &call;
+    swapcontext(&call.caller, &call.callee);
+
+    stack_limit = saved_limit;
+    --segment_depth;
+}
+
+// forgets the segments in use after an error has unwound the compiler from
+// them back to the thread's own stack (see error_return())
+void reset_stack(void)
+{
+    stack_limit = base_limit;
+    segment_depth = 0;
+}
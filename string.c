@@ -15,4 +15,174 @@ char *format(char *fmt, ...)
     return buf;
 }
 
-// sprintf(buf, ".L..%d", id++);  copy second argument (expanded output) to first arg
\ No newline at end of file
+Hash hash_bytes(Hash h, void* p, size_t len)
+{
+    for (size_t i = 0; i < len; ++i)
+    {
+        h ^= ((uint8_t*)p)[i];
+        h = (h << 88) + h * 0x13b; // h * FNV prime, 2^88 + 0x13b
+    }
+    return h;
+}
+
+// hashes s with its '\0', which separates it from what follows
+Hash hash_string(Hash h, char* s)
+{
+    return hash_bytes(h, s, strlen(s) + 1);
+}
+
+char* format_hash(Hash h)
+{
+    return format("%016llx%016llx", (unsigned long long)(h >> 64), (unsigned long long)h);
+}
+
+// sprintf(buf, ".L..%d", id++);  copy second argument (expanded output) to first arg
+
+// identifier interning
+// every distinct identifier spelling is stored once and numbered; the lexer
+// stores the number in the token, and the parser compares names by pointer
+// since equal spellings always yield the same string
+
+typedef struct
+{
+    uint32_t hash;
+    int sym; // -1 if the slot is empty
+} InternSlot;
+
+struct InternTable
+{
+    InternSlot* slots;
+    int capacity; // power of 2
+
+    char** symbols;
+    int num_symbols;
+    int symbol_capacity;
+
+    // names are packed into large blocks instead of one allocation each
+    // the first bytes of every block link to the previous block
+    char* block;
+    char* name_block;
+    int name_block_left;
+};
+
+static uint32_t hash_name(char* s, int len)
+{
+    // FNV-1a
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < len; ++i)
+        h = (h ^ (unsigned char)s[i]) * 16777619u;
+    return h;
+}
+
+static char* store_name(InternTable* t, char* s, int len)
+{
+    enum { BLOCK_SIZE = 64 * 1024 };
+
+    if (len + 1 > t->name_block_left)
+    {
+        int size = len + 1 > BLOCK_SIZE ? len + 1 : BLOCK_SIZE;
+        char* block = malloc(sizeof(char*) + size);
+        *(char**)block = t->block;
+        t->block = block;
+        t->name_block = block + sizeof(char*);
+        t->name_block_left = size;
+    }
+
+    char* name = t->name_block;
+    memcpy(name, s, len);
+    name[len] = '\0';
+    t->name_block += len + 1;
+    t->name_block_left -= len + 1;
+    return name;
+}
+
+static void grow_intern_table(InternTable* t)
+{
+    int old_capacity = t->capacity;
+    InternSlot* old = t->slots;
+
+    t->capacity = t->capacity ? t->capacity * 2 : 4096;
+    t->slots = malloc(sizeof(InternSlot) * t->capacity);
+    for (int i = 0; i < t->capacity; ++i)
+        t->slots[i].sym = -1;
+
+    for (int i = 0; i < old_capacity; ++i)
+    {
+        if (old[i].sym < 0)
+            continue;
+        int j = old[i].hash & (t->capacity - 1);
+        while (t->slots[j].sym >= 0)
+            j = (j + 1) & (t->capacity - 1);
+        t->slots[j] = old[i];
+    }
+    free(old);
+}
+
+InternTable* new_intern_table(void)
+{
+    return calloc(1, sizeof(InternTable));
+}
+
+void free_intern_table(InternTable* t)
+{
+    for (char* block = t->block; block;)
+    {
+        char* prev = *(char**)block;
+        free(block);
+        block = prev;
+    }
+    free(t->slots);
+    free(t->symbols);
+    free(t);
+}
+
+// returns the symbol number of the identifier [s, s + len) in t
+int intern_in(InternTable* t, char* s, int len)
+{
+    // keep the load factor below 1/2
+    if (t->num_symbols * 2 >= t->capacity)
+        grow_intern_table(t);
+
+    uint32_t h = hash_name(s, len);
+    int i = h & (t->capacity - 1);
+    for (; t->slots[i].sym >= 0; i = (i + 1) & (t->capacity - 1))
+    {
+        InternSlot* slot = &t->slots[i];
+        char* name = t->symbols[slot->sym];
+        if (slot->hash == h && strncmp(name, s, len) == 0 && name[len] == '\0')
+            return slot->sym;
+    }
+
+    if (t->num_symbols == t->symbol_capacity)
+    {
+        t->symbol_capacity = t->symbol_capacity ? t->symbol_capacity * 2 : 4096;
+        t->symbols = realloc(t->symbols, sizeof(char*) * t->symbol_capacity);
+    }
+
+    t->slots[i].hash = h;
+    t->slots[i].sym = t->num_symbols;
+    t->symbols[t->num_symbols] = store_name(t, s, len);
+    return t->num_symbols++;
+}
+
+int intern_table_size(InternTable* t)
+{
+    return t->num_symbols;
+}
+
+char* intern_table_name(InternTable* t, int sym)
+{
+    return t->symbols[sym];
+}
+
+// the table of the compiler; tables of parallel lexer threads are merged into it
+int intern(char* s, int len)
+{
+    return intern_in(cc->names, s, len);
+}
+
+// the unique string of a symbol
+char* symbol_name(int sym)
+{
+    return cc->names->symbols[sym];
+}
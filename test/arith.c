@@ -31,8 +31,18 @@ int main()
     ASSERT(1, 1 >= 0);
     ASSERT(1, 1 >= 1);
     ASSERT(0, 1 >= 2);
+    ASSERT(1, 1 < 2 < 3);
+    ASSERT(0, 3 > 2 > 1);
 
     ASSERT(0, 1073741824 * 100 / 100);
+
+    ASSERT(0, 2147483647 + 1 + 2147483647 + 1);
+    ASSERT(7, sizeof(int) * 2 - 1);
+    ASSERT(3, ({ int x = 3; x + 0; }));
+    ASSERT(3, ({ int x = 3; 0 + x * 1 / 1 - 0; }));
+    ASSERT(0, ({ int x = 3; x * 0; }));
+    ASSERT(1, ({ int x = 0; (x = 1) * 0; x; }));
+    ASSERT(-3, ({ int x = 3; - - -x; }));
     printf("OK\n");
     return 0;
 }
\ No newline at end of file
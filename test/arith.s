@@ -0,0 +1,1225 @@
+.file 1 "test/arith.c"
+.file 2 "test/test.h"
+    .data
+    .global .L..main.36
+.L..main.36:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+    .data
+    .global .L..main.35
+.L..main.35:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 45
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.34
+.L..main.34:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 40
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 41
+    .byte 32
+    .byte 42
+    .byte 32
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.33
+.L..main.33:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 42
+    .byte 32
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.32
+.L..main.32:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 48
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 42
+    .byte 32
+    .byte 49
+    .byte 32
+    .byte 47
+    .byte 32
+    .byte 49
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.31
+.L..main.31:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.30
+.L..main.30:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 41
+    .byte 32
+    .byte 42
+    .byte 32
+    .byte 50
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.29
+.L..main.29:
+    .byte 50
+    .byte 49
+    .byte 52
+    .byte 55
+    .byte 52
+    .byte 56
+    .byte 51
+    .byte 54
+    .byte 52
+    .byte 55
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 49
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 50
+    .byte 49
+    .byte 52
+    .byte 55
+    .byte 52
+    .byte 56
+    .byte 51
+    .byte 54
+    .byte 52
+    .byte 55
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.28
+.L..main.28:
+    .byte 49
+    .byte 48
+    .byte 55
+    .byte 51
+    .byte 55
+    .byte 52
+    .byte 49
+    .byte 56
+    .byte 50
+    .byte 52
+    .byte 32
+    .byte 42
+    .byte 32
+    .byte 49
+    .byte 48
+    .byte 48
+    .byte 32
+    .byte 47
+    .byte 32
+    .byte 49
+    .byte 48
+    .byte 48
+    .byte 0
+    .data
+    .global .L..main.27
+.L..main.27:
+    .byte 51
+    .byte 32
+    .byte 62
+    .byte 32
+    .byte 50
+    .byte 32
+    .byte 62
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.26
+.L..main.26:
+    .byte 49
+    .byte 32
+    .byte 60
+    .byte 32
+    .byte 50
+    .byte 32
+    .byte 60
+    .byte 32
+    .byte 51
+    .byte 0
+    .data
+    .global .L..main.25
+.L..main.25:
+    .byte 49
+    .byte 32
+    .byte 62
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 0
+    .data
+    .global .L..main.24
+.L..main.24:
+    .byte 49
+    .byte 32
+    .byte 62
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.23
+.L..main.23:
+    .byte 49
+    .byte 32
+    .byte 62
+    .byte 61
+    .byte 32
+    .byte 48
+    .byte 0
+    .data
+    .global .L..main.22
+.L..main.22:
+    .byte 49
+    .byte 32
+    .byte 62
+    .byte 32
+    .byte 50
+    .byte 0
+    .data
+    .global .L..main.21
+.L..main.21:
+    .byte 49
+    .byte 32
+    .byte 62
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.20
+.L..main.20:
+    .byte 49
+    .byte 32
+    .byte 62
+    .byte 32
+    .byte 48
+    .byte 0
+    .data
+    .global .L..main.19
+.L..main.19:
+    .byte 50
+    .byte 32
+    .byte 60
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.18
+.L..main.18:
+    .byte 49
+    .byte 32
+    .byte 60
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.17
+.L..main.17:
+    .byte 48
+    .byte 32
+    .byte 60
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.16
+.L..main.16:
+    .byte 50
+    .byte 32
+    .byte 60
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.15
+.L..main.15:
+    .byte 49
+    .byte 32
+    .byte 60
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.14
+.L..main.14:
+    .byte 48
+    .byte 32
+    .byte 60
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.13
+.L..main.13:
+    .byte 52
+    .byte 50
+    .byte 32
+    .byte 33
+    .byte 61
+    .byte 32
+    .byte 52
+    .byte 50
+    .byte 0
+    .data
+    .global .L..main.12
+.L..main.12:
+    .byte 48
+    .byte 32
+    .byte 33
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.11
+.L..main.11:
+    .byte 52
+    .byte 50
+    .byte 32
+    .byte 61
+    .byte 61
+    .byte 32
+    .byte 52
+    .byte 50
+    .byte 0
+    .data
+    .global .L..main.10
+.L..main.10:
+    .byte 48
+    .byte 32
+    .byte 61
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.9
+.L..main.9:
+    .byte 45
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 43
+    .byte 49
+    .byte 48
+    .byte 0
+    .data
+    .global .L..main.8
+.L..main.8:
+    .byte 45
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 49
+    .byte 48
+    .byte 0
+    .data
+    .global .L..main.7
+.L..main.7:
+    .byte 45
+    .byte 49
+    .byte 48
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 50
+    .byte 48
+    .byte 0
+    .data
+    .global .L..main.6
+.L..main.6:
+    .byte 40
+    .byte 51
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 53
+    .byte 41
+    .byte 32
+    .byte 47
+    .byte 32
+    .byte 50
+    .byte 0
+    .data
+    .global .L..main.5
+.L..main.5:
+    .byte 53
+    .byte 32
+    .byte 42
+    .byte 32
+    .byte 40
+    .byte 57
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 54
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.4
+.L..main.4:
+    .byte 53
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 54
+    .byte 32
+    .byte 42
+    .byte 32
+    .byte 55
+    .byte 0
+    .data
+    .global .L..main.3
+.L..main.3:
+    .byte 49
+    .byte 50
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 51
+    .byte 52
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 53
+    .byte 0
+    .data
+    .global .L..main.2
+.L..main.2:
+    .byte 53
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 50
+    .byte 48
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 52
+    .byte 0
+    .data
+    .global .L..main.1
+.L..main.1:
+    .byte 52
+    .byte 50
+    .byte 0
+    .data
+    .global .L..main.0
+.L..main.0:
+    .byte 48
+    .byte 0
+    .global main
+    .text
+main:
+    push %rbp
+    mov %rsp, %rbp
+    sub $32, %rsp
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    mov $0, %rax
+    push %rax
+   .loc 1 5
+    mov $0, %rax
+    push %rax
+   .loc 1 5
+    lea .L..main.0(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    mov $42, %rax
+    push %rax
+   .loc 1 6
+    mov $42, %rax
+    push %rax
+   .loc 1 6
+    lea .L..main.1(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    mov $21, %rax
+    push %rax
+   .loc 1 7
+    mov $21, %rax
+    push %rax
+   .loc 1 7
+    lea .L..main.2(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    mov $41, %rax
+    push %rax
+   .loc 1 8
+    mov $41, %rax
+    push %rax
+   .loc 1 8
+    lea .L..main.3(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    mov $47, %rax
+    push %rax
+   .loc 1 9
+    mov $47, %rax
+    push %rax
+   .loc 1 9
+    lea .L..main.4(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    mov $15, %rax
+    push %rax
+   .loc 1 10
+    mov $15, %rax
+    push %rax
+   .loc 1 10
+    lea .L..main.5(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    mov $4, %rax
+    push %rax
+   .loc 1 11
+    mov $4, %rax
+    push %rax
+   .loc 1 11
+    lea .L..main.6(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    mov $10, %rax
+    push %rax
+   .loc 1 12
+    mov $10, %rax
+    push %rax
+   .loc 1 12
+    lea .L..main.7(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    mov $10, %rax
+    push %rax
+   .loc 1 13
+    mov $10, %rax
+    push %rax
+   .loc 1 13
+    lea .L..main.8(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    mov $10, %rax
+    push %rax
+   .loc 1 14
+    mov $10, %rax
+    push %rax
+   .loc 1 14
+    lea .L..main.9(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+    mov $0, %rax
+    push %rax
+   .loc 1 16
+    mov $0, %rax
+    push %rax
+   .loc 1 16
+    lea .L..main.10(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    mov $1, %rax
+    push %rax
+   .loc 1 17
+    mov $1, %rax
+    push %rax
+   .loc 1 17
+    lea .L..main.11(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 18
+   .loc 1 18
+   .loc 1 18
+    mov $1, %rax
+    push %rax
+   .loc 1 18
+    mov $1, %rax
+    push %rax
+   .loc 1 18
+    lea .L..main.12(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+    mov $0, %rax
+    push %rax
+   .loc 1 19
+    mov $0, %rax
+    push %rax
+   .loc 1 19
+    lea .L..main.13(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    mov $1, %rax
+    push %rax
+   .loc 1 21
+    mov $1, %rax
+    push %rax
+   .loc 1 21
+    lea .L..main.14(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 22
+   .loc 1 22
+   .loc 1 22
+    mov $0, %rax
+    push %rax
+   .loc 1 22
+    mov $0, %rax
+    push %rax
+   .loc 1 22
+    lea .L..main.15(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+    mov $0, %rax
+    push %rax
+   .loc 1 23
+    mov $0, %rax
+    push %rax
+   .loc 1 23
+    lea .L..main.16(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+    mov $1, %rax
+    push %rax
+   .loc 1 24
+    mov $1, %rax
+    push %rax
+   .loc 1 24
+    lea .L..main.17(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+    mov $1, %rax
+    push %rax
+   .loc 1 25
+    mov $1, %rax
+    push %rax
+   .loc 1 25
+    lea .L..main.18(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    mov $0, %rax
+    push %rax
+   .loc 1 26
+    mov $0, %rax
+    push %rax
+   .loc 1 26
+    lea .L..main.19(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    mov $1, %rax
+    push %rax
+   .loc 1 28
+    mov $1, %rax
+    push %rax
+   .loc 1 28
+    lea .L..main.20(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 29
+   .loc 1 29
+   .loc 1 29
+    mov $0, %rax
+    push %rax
+   .loc 1 29
+    mov $0, %rax
+    push %rax
+   .loc 1 29
+    lea .L..main.21(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+    mov $0, %rax
+    push %rax
+   .loc 1 30
+    mov $0, %rax
+    push %rax
+   .loc 1 30
+    lea .L..main.22(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+    mov $1, %rax
+    push %rax
+   .loc 1 31
+    mov $1, %rax
+    push %rax
+   .loc 1 31
+    lea .L..main.23(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $1, %rax
+    push %rax
+   .loc 1 32
+    mov $1, %rax
+    push %rax
+   .loc 1 32
+    lea .L..main.24(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $0, %rax
+    push %rax
+   .loc 1 33
+    mov $0, %rax
+    push %rax
+   .loc 1 33
+    lea .L..main.25(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $1, %rax
+    push %rax
+   .loc 1 34
+    mov $1, %rax
+    push %rax
+   .loc 1 34
+    lea .L..main.26(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+    mov $0, %rax
+    push %rax
+   .loc 1 35
+    mov $0, %rax
+    push %rax
+   .loc 1 35
+    lea .L..main.27(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+    mov $0, %rax
+    push %rax
+   .loc 1 37
+    mov $0, %rax
+    push %rax
+   .loc 1 37
+    lea .L..main.28(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+    mov $0, %rax
+    push %rax
+   .loc 1 39
+    mov $0, %rax
+    push %rax
+   .loc 1 39
+    lea .L..main.29(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    mov $7, %rax
+    push %rax
+   .loc 1 40
+    mov $7, %rax
+    push %rax
+   .loc 1 40
+    lea .L..main.30(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    mov $3, %rax
+    push %rax
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    lea -20(%rbp), %rax
+    push %rax
+   .loc 1 41
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 41
+   .loc 1 41
+    lea -20(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 41
+    lea .L..main.31(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 42
+   .loc 1 42
+   .loc 1 42
+    mov $3, %rax
+    push %rax
+   .loc 1 42
+   .loc 1 42
+   .loc 1 42
+   .loc 1 42
+    lea -16(%rbp), %rax
+    push %rax
+   .loc 1 42
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 42
+   .loc 1 42
+    lea -16(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 42
+    lea .L..main.32(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 43
+   .loc 1 43
+   .loc 1 43
+    mov $0, %rax
+    push %rax
+   .loc 1 43
+   .loc 1 43
+   .loc 1 43
+   .loc 1 43
+    lea -12(%rbp), %rax
+    push %rax
+   .loc 1 43
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 43
+   .loc 1 43
+    mov $0, %rax
+    push %rax
+   .loc 1 43
+    lea .L..main.33(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 44
+   .loc 1 44
+   .loc 1 44
+    mov $1, %rax
+    push %rax
+   .loc 1 44
+   .loc 1 44
+   .loc 1 44
+   .loc 1 44
+    lea -8(%rbp), %rax
+    push %rax
+   .loc 1 44
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 44
+   .loc 1 44
+   .loc 1 44
+    mov $0, %rax
+    push %rax
+   .loc 1 44
+    lea -8(%rbp), %rax
+    push %rax
+   .loc 1 44
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+    pop %rdi
+    imul %edi, %eax
+   .loc 1 44
+   .loc 1 44
+    lea -8(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 44
+    lea .L..main.34(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+    mov $-3, %rax
+    push %rax
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+    lea -4(%rbp), %rax
+    push %rax
+   .loc 1 45
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    neg %rax
+    push %rax
+   .loc 1 45
+    lea .L..main.35(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 46
+   .loc 1 46
+   .loc 1 46
+    lea .L..main.36(%rip), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call printf
+   .loc 1 47
+   .loc 1 47
+    mov $0, %rax
+    jmp .L.return.main
+.L.return.main:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
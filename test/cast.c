@@ -5,6 +5,8 @@ int main() {
     ASSERT(513, (short)8590066177);
     ASSERT(1, (char)8590066177);
     ASSERT(1, (long)1);
+    ASSERT(-128, (char)(127 + 1));
+    ASSERT(0, (char)(255 + 1));
     ASSERT(0, (long)&*(int*)0);
     ASSERT(513, ({ int x = 512; *(char*)&x = 1; x; }));
     ASSERT(5, ({ int x = 5; long y = (long)&x; *(int*)y; }));
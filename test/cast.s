@@ -0,0 +1,448 @@
+.file 1 "test/cast.c"
+.file 2 "test/test.h"
+    .data
+    .global .L..main.9
+.L..main.9:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+    .data
+    .global .L..main.8
+.L..main.8:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 32
+    .byte 121
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 41
+    .byte 38
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 42
+    .byte 41
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.7
+.L..main.7:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 53
+    .byte 49
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 42
+    .byte 41
+    .byte 38
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.6
+.L..main.6:
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 41
+    .byte 38
+    .byte 42
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 42
+    .byte 41
+    .byte 48
+    .byte 0
+    .data
+    .global .L..main.5
+.L..main.5:
+    .byte 40
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 41
+    .byte 40
+    .byte 50
+    .byte 53
+    .byte 53
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 49
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.4
+.L..main.4:
+    .byte 40
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 41
+    .byte 40
+    .byte 49
+    .byte 50
+    .byte 55
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 49
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.3
+.L..main.3:
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 41
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.2
+.L..main.2:
+    .byte 40
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 41
+    .byte 56
+    .byte 53
+    .byte 57
+    .byte 48
+    .byte 48
+    .byte 54
+    .byte 54
+    .byte 49
+    .byte 55
+    .byte 55
+    .byte 0
+    .data
+    .global .L..main.1
+.L..main.1:
+    .byte 40
+    .byte 115
+    .byte 104
+    .byte 111
+    .byte 114
+    .byte 116
+    .byte 41
+    .byte 56
+    .byte 53
+    .byte 57
+    .byte 48
+    .byte 48
+    .byte 54
+    .byte 54
+    .byte 49
+    .byte 55
+    .byte 55
+    .byte 0
+    .data
+    .global .L..main.0
+.L..main.0:
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 41
+    .byte 56
+    .byte 53
+    .byte 57
+    .byte 48
+    .byte 48
+    .byte 54
+    .byte 54
+    .byte 49
+    .byte 55
+    .byte 55
+    .byte 0
+    .global main
+    .text
+main:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   .loc 1 4
+   .loc 1 4
+   .loc 1 4
+   .loc 1 4
+    mov $131585, %rax
+    push %rax
+   .loc 1 4
+    mov $131585, %rax
+    push %rax
+   .loc 1 4
+    lea .L..main.0(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    mov $513, %rax
+    push %rax
+   .loc 1 5
+    mov $513, %rax
+    push %rax
+   .loc 1 5
+    lea .L..main.1(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    mov $1, %rax
+    push %rax
+   .loc 1 6
+    mov $1, %rax
+    push %rax
+   .loc 1 6
+    lea .L..main.2(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    mov $1, %rax
+    push %rax
+   .loc 1 7
+    mov $1, %rax
+    push %rax
+   .loc 1 7
+    lea .L..main.3(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    mov $-128, %rax
+    push %rax
+   .loc 1 8
+    mov $-128, %rax
+    push %rax
+   .loc 1 8
+    lea .L..main.4(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    mov $0, %rax
+    push %rax
+   .loc 1 9
+    mov $0, %rax
+    push %rax
+   .loc 1 9
+    lea .L..main.5(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    mov $0, %rax
+    push %rax
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    mov $0, %rax
+    push %rax
+   .loc 1 10
+    lea .L..main.6(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    mov $513, %rax
+    push %rax
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    lea -16(%rbp), %rax
+    push %rax
+   .loc 1 11
+    mov $512, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    lea -16(%rbp), %rax
+    push %rax
+   .loc 1 11
+    mov $1, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 11
+   .loc 1 11
+    lea -16(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 11
+    lea .L..main.7(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    mov $5, %rax
+    push %rax
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea -12(%rbp), %rax
+    push %rax
+   .loc 1 12
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea -8(%rbp), %rax
+    push %rax
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea -12(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea -8(%rbp), %rax
+    mov (%rax), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 12
+    lea .L..main.8(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    mov $1, %rax
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+    lea .L..main.9(%rip), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call printf
+   .loc 1 16
+   .loc 1 16
+    mov $0, %rax
+    jmp .L.return.main
+.L.return.main:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
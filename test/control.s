@@ -0,0 +1,1173 @@
+.file 1 "test/control.c"
+.file 2 "test/test.h"
+    .data
+    .global .L..main.13
+.L..main.13:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+    .data
+    .global .L..main.12
+.L..main.12:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 105
+    .byte 61
+    .byte 50
+    .byte 44
+    .byte 32
+    .byte 106
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 40
+    .byte 105
+    .byte 61
+    .byte 53
+    .byte 44
+    .byte 106
+    .byte 41
+    .byte 61
+    .byte 54
+    .byte 59
+    .byte 32
+    .byte 106
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.11
+.L..main.11:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 105
+    .byte 61
+    .byte 50
+    .byte 44
+    .byte 32
+    .byte 106
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 40
+    .byte 105
+    .byte 61
+    .byte 53
+    .byte 44
+    .byte 106
+    .byte 41
+    .byte 61
+    .byte 54
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.10
+.L..main.10:
+    .byte 40
+    .byte 49
+    .byte 44
+    .byte 32
+    .byte 50
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.9
+.L..main.9:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 105
+    .byte 61
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 106
+    .byte 61
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 119
+    .byte 104
+    .byte 105
+    .byte 108
+    .byte 101
+    .byte 40
+    .byte 105
+    .byte 60
+    .byte 61
+    .byte 49
+    .byte 48
+    .byte 41
+    .byte 32
+    .byte 123
+    .byte 106
+    .byte 61
+    .byte 105
+    .byte 43
+    .byte 106
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 61
+    .byte 105
+    .byte 43
+    .byte 49
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 106
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.8
+.L..main.8:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 105
+    .byte 61
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 119
+    .byte 104
+    .byte 105
+    .byte 108
+    .byte 101
+    .byte 40
+    .byte 105
+    .byte 60
+    .byte 49
+    .byte 48
+    .byte 41
+    .byte 32
+    .byte 105
+    .byte 61
+    .byte 105
+    .byte 43
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.7
+.L..main.7:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 59
+    .byte 59
+    .byte 59
+    .byte 32
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.6
+.L..main.6:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 123
+    .byte 50
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.5
+.L..main.5:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 105
+    .byte 61
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 119
+    .byte 104
+    .byte 105
+    .byte 108
+    .byte 101
+    .byte 40
+    .byte 105
+    .byte 60
+    .byte 49
+    .byte 48
+    .byte 41
+    .byte 32
+    .byte 105
+    .byte 61
+    .byte 105
+    .byte 43
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.4
+.L..main.4:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 105
+    .byte 61
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 106
+    .byte 61
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 102
+    .byte 111
+    .byte 114
+    .byte 32
+    .byte 40
+    .byte 105
+    .byte 61
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 60
+    .byte 61
+    .byte 49
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 61
+    .byte 105
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 32
+    .byte 106
+    .byte 61
+    .byte 105
+    .byte 43
+    .byte 106
+    .byte 59
+    .byte 32
+    .byte 106
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.3
+.L..main.3:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 102
+    .byte 32
+    .byte 40
+    .byte 50
+    .byte 45
+    .byte 49
+    .byte 41
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 101
+    .byte 108
+    .byte 115
+    .byte 101
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.2
+.L..main.2:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 102
+    .byte 32
+    .byte 40
+    .byte 49
+    .byte 41
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 101
+    .byte 108
+    .byte 115
+    .byte 101
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.1
+.L..main.1:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 102
+    .byte 32
+    .byte 40
+    .byte 49
+    .byte 45
+    .byte 49
+    .byte 41
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 101
+    .byte 108
+    .byte 115
+    .byte 101
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.0
+.L..main.0:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 102
+    .byte 32
+    .byte 40
+    .byte 48
+    .byte 41
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 101
+    .byte 108
+    .byte 115
+    .byte 101
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .global main
+    .text
+main:
+    push %rbp
+    mov %rsp, %rbp
+    sub $64, %rsp
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    mov $3, %rax
+    push %rax
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    mov $0, %rax
+    cmp $0, %rax
+    je .L.else.main.1
+   .loc 1 5
+   .loc 1 5
+    lea -56(%rbp), %rax
+    push %rax
+   .loc 1 5
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+    jmp .L.end.main.1
+.L.else.main.1:
+   .loc 1 5
+   .loc 1 5
+    lea -56(%rbp), %rax
+    push %rax
+   .loc 1 5
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+.L.end.main.1:
+   .loc 1 5
+   .loc 1 5
+    lea -56(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 5
+    lea .L..main.0(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    mov $3, %rax
+    push %rax
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    mov $0, %rax
+    cmp $0, %rax
+    je .L.else.main.2
+   .loc 1 6
+   .loc 1 6
+    lea -52(%rbp), %rax
+    push %rax
+   .loc 1 6
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+    jmp .L.end.main.2
+.L.else.main.2:
+   .loc 1 6
+   .loc 1 6
+    lea -52(%rbp), %rax
+    push %rax
+   .loc 1 6
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+.L.end.main.2:
+   .loc 1 6
+   .loc 1 6
+    lea -52(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 6
+    lea .L..main.1(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    mov $2, %rax
+    push %rax
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    mov $1, %rax
+    cmp $0, %rax
+    je .L.else.main.3
+   .loc 1 7
+   .loc 1 7
+    lea -48(%rbp), %rax
+    push %rax
+   .loc 1 7
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+    jmp .L.end.main.3
+.L.else.main.3:
+   .loc 1 7
+   .loc 1 7
+    lea -48(%rbp), %rax
+    push %rax
+   .loc 1 7
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+.L.end.main.3:
+   .loc 1 7
+   .loc 1 7
+    lea -48(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 7
+    lea .L..main.2(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    mov $2, %rax
+    push %rax
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    mov $1, %rax
+    cmp $0, %rax
+    je .L.else.main.4
+   .loc 1 8
+   .loc 1 8
+    lea -44(%rbp), %rax
+    push %rax
+   .loc 1 8
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+    jmp .L.end.main.4
+.L.else.main.4:
+   .loc 1 8
+   .loc 1 8
+    lea -44(%rbp), %rax
+    push %rax
+   .loc 1 8
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+.L.end.main.4:
+   .loc 1 8
+   .loc 1 8
+    lea -44(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 8
+    lea .L..main.3(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    mov $55, %rax
+    push %rax
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    lea -40(%rbp), %rax
+    push %rax
+   .loc 1 10
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    lea -36(%rbp), %rax
+    push %rax
+   .loc 1 10
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    lea -40(%rbp), %rax
+    push %rax
+   .loc 1 10
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+.L.begin.main.5:
+   .loc 1 10
+   .loc 1 10
+    mov $10, %rax
+    push %rax
+   .loc 1 10
+    lea -40(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    cmp %edi, %eax
+    setle %al
+    movzb %al, %rax
+    cmp $0, %rax
+    je .L.end.main.5
+   .loc 1 10
+   .loc 1 10
+    lea -36(%rbp), %rax
+    push %rax
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    lea -36(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 10
+    lea -40(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 10
+    lea -40(%rbp), %rax
+    push %rax
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    mov $1, %rax
+    push %rax
+   .loc 1 10
+    lea -40(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    pop %rdi
+   mov %eax, (%rdi)
+    jmp .L.begin.main.5
+.L.end.main.5:
+   .loc 1 10
+   .loc 1 10
+    lea -36(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 10
+    lea .L..main.4(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    mov $10, %rax
+    push %rax
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea -32(%rbp), %rax
+    push %rax
+   .loc 1 12
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 12
+.L.begin.main.6:
+   .loc 1 12
+   .loc 1 12
+    mov $10, %rax
+    push %rax
+   .loc 1 12
+    lea -32(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    cmp %edi, %eax
+    setl %al
+    movzb %al, %rax
+    cmp $0, %rax
+    je .L.end.main.6
+   .loc 1 12
+   .loc 1 12
+    lea -32(%rbp), %rax
+    push %rax
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    mov $1, %rax
+    push %rax
+   .loc 1 12
+    lea -32(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    pop %rdi
+   mov %eax, (%rdi)
+    jmp .L.begin.main.6
+.L.end.main.6:
+   .loc 1 12
+   .loc 1 12
+    lea -32(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 12
+    lea .L..main.5(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    mov $3, %rax
+    push %rax
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    mov $1, %rax
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    mov $2, %rax
+   .loc 1 14
+   .loc 1 14
+    mov $3, %rax
+    push %rax
+   .loc 1 14
+    lea .L..main.6(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+    mov $5, %rax
+    push %rax
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+    mov $5, %rax
+    push %rax
+   .loc 1 15
+    lea .L..main.7(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    mov $10, %rax
+    push %rax
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    lea -28(%rbp), %rax
+    push %rax
+   .loc 1 17
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 17
+.L.begin.main.7:
+   .loc 1 17
+   .loc 1 17
+    mov $10, %rax
+    push %rax
+   .loc 1 17
+    lea -28(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    cmp %edi, %eax
+    setl %al
+    movzb %al, %rax
+    cmp $0, %rax
+    je .L.end.main.7
+   .loc 1 17
+   .loc 1 17
+    lea -28(%rbp), %rax
+    push %rax
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    mov $1, %rax
+    push %rax
+   .loc 1 17
+    lea -28(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    pop %rdi
+   mov %eax, (%rdi)
+    jmp .L.begin.main.7
+.L.end.main.7:
+   .loc 1 17
+   .loc 1 17
+    lea -28(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 17
+    lea .L..main.8(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 18
+   .loc 1 18
+   .loc 1 18
+    mov $55, %rax
+    push %rax
+   .loc 1 18
+   .loc 1 18
+   .loc 1 18
+   .loc 1 18
+    lea -24(%rbp), %rax
+    push %rax
+   .loc 1 18
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 18
+   .loc 1 18
+   .loc 1 18
+    lea -20(%rbp), %rax
+    push %rax
+   .loc 1 18
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 18
+.L.begin.main.8:
+   .loc 1 18
+   .loc 1 18
+    mov $10, %rax
+    push %rax
+   .loc 1 18
+    lea -24(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    cmp %edi, %eax
+    setle %al
+    movzb %al, %rax
+    cmp $0, %rax
+    je .L.end.main.8
+   .loc 1 18
+   .loc 1 18
+   .loc 1 18
+    lea -20(%rbp), %rax
+    push %rax
+   .loc 1 18
+   .loc 1 18
+   .loc 1 18
+    lea -20(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 18
+    lea -24(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 18
+   .loc 1 18
+    lea -24(%rbp), %rax
+    push %rax
+   .loc 1 18
+   .loc 1 18
+   .loc 1 18
+    mov $1, %rax
+    push %rax
+   .loc 1 18
+    lea -24(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    pop %rdi
+   mov %eax, (%rdi)
+    jmp .L.begin.main.8
+.L.end.main.8:
+   .loc 1 18
+   .loc 1 18
+    lea -20(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 18
+    lea .L..main.9(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+    mov $3, %rax
+    push %rax
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+    mov $1, %rax
+   .loc 1 20
+    mov $2, %rax
+   .loc 1 20
+    mov $3, %rax
+    push %rax
+   .loc 1 20
+    lea .L..main.10(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    mov $5, %rax
+    push %rax
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    lea -16(%rbp), %rax
+    push %rax
+   .loc 1 21
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 21
+   .loc 1 21
+    lea -12(%rbp), %rax
+    push %rax
+   .loc 1 21
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    lea -16(%rbp), %rax
+    push %rax
+   .loc 1 21
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+    lea -12(%rbp), %rax
+    push %rax
+   .loc 1 21
+    mov $6, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 21
+   .loc 1 21
+    lea -16(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 21
+    lea .L..main.11(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 22
+   .loc 1 22
+   .loc 1 22
+    mov $6, %rax
+    push %rax
+   .loc 1 22
+   .loc 1 22
+   .loc 1 22
+   .loc 1 22
+    lea -8(%rbp), %rax
+    push %rax
+   .loc 1 22
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 22
+   .loc 1 22
+    lea -4(%rbp), %rax
+    push %rax
+   .loc 1 22
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 22
+   .loc 1 22
+   .loc 1 22
+    lea -8(%rbp), %rax
+    push %rax
+   .loc 1 22
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+    lea -4(%rbp), %rax
+    push %rax
+   .loc 1 22
+    mov $6, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 22
+   .loc 1 22
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 22
+    lea .L..main.12(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+    lea .L..main.13(%rip), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call printf
+   .loc 1 24
+   .loc 1 24
+    mov $0, %rax
+    jmp .L.return.main
+.L.return.main:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
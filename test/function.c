@@ -52,9 +52,35 @@ int g1;
 
 int* g1_ptr() { return &g1; }
 char int_to_char(int x) { return x; }
+static int static_fib(int n);
+
+static inline int static_twice(int x)
+{
+    return x + x;
+}
+
+static int static_unused(int x)
+{
+    return static_fib(x);
+}
+
+int call_fib(int n)
+{
+    return static_fib(n);
+}
+
+static int static_fib(int n)
+{
+    if (n <= 1)
+        return 1;
+    return static_fib(n - 1) + static_fib(n - 2);
+}
+
 int main()
 {
     ASSERT(3, ret3());
+    ASSERT(8, static_twice(4));
+    ASSERT(89, call_fib(10));
     ASSERT(8, add2(3, 5));
     ASSERT(2, sub2(5, 3));
     ASSERT(21, add6(1, 2, 3, 4, 5, 6));
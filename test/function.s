@@ -0,0 +1,1420 @@
+.file 1 "test/function.c"
+.file 2 "test/test.h"
+    .data
+    .global g1
+g1:
+    .zero 4
+    .data
+    .global .L..main.16
+.L..main.16:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+    .data
+    .global .L..main.15
+.L..main.15:
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 95
+    .byte 116
+    .byte 111
+    .byte 95
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 40
+    .byte 50
+    .byte 54
+    .byte 49
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.14
+.L..main.14:
+    .byte 42
+    .byte 103
+    .byte 49
+    .byte 95
+    .byte 112
+    .byte 116
+    .byte 114
+    .byte 40
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.13
+.L..main.13:
+    .byte 115
+    .byte 117
+    .byte 98
+    .byte 95
+    .byte 115
+    .byte 104
+    .byte 111
+    .byte 114
+    .byte 116
+    .byte 40
+    .byte 55
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.12
+.L..main.12:
+    .byte 115
+    .byte 117
+    .byte 98
+    .byte 95
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 40
+    .byte 55
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.11
+.L..main.11:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 117
+    .byte 98
+    .byte 95
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 40
+    .byte 55
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.10
+.L..main.10:
+    .byte 102
+    .byte 105
+    .byte 98
+    .byte 40
+    .byte 57
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.9
+.L..main.9:
+    .byte 115
+    .byte 117
+    .byte 98
+    .byte 50
+    .byte 40
+    .byte 52
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.8
+.L..main.8:
+    .byte 97
+    .byte 100
+    .byte 100
+    .byte 50
+    .byte 40
+    .byte 51
+    .byte 44
+    .byte 32
+    .byte 52
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.7
+.L..main.7:
+    .byte 97
+    .byte 100
+    .byte 100
+    .byte 54
+    .byte 40
+    .byte 49
+    .byte 44
+    .byte 32
+    .byte 50
+    .byte 44
+    .byte 32
+    .byte 97
+    .byte 100
+    .byte 100
+    .byte 54
+    .byte 40
+    .byte 51
+    .byte 44
+    .byte 32
+    .byte 97
+    .byte 100
+    .byte 100
+    .byte 54
+    .byte 40
+    .byte 52
+    .byte 44
+    .byte 32
+    .byte 53
+    .byte 44
+    .byte 32
+    .byte 54
+    .byte 44
+    .byte 32
+    .byte 55
+    .byte 44
+    .byte 32
+    .byte 56
+    .byte 44
+    .byte 32
+    .byte 57
+    .byte 41
+    .byte 44
+    .byte 32
+    .byte 49
+    .byte 48
+    .byte 44
+    .byte 32
+    .byte 49
+    .byte 49
+    .byte 44
+    .byte 32
+    .byte 49
+    .byte 50
+    .byte 44
+    .byte 32
+    .byte 49
+    .byte 51
+    .byte 41
+    .byte 44
+    .byte 32
+    .byte 49
+    .byte 52
+    .byte 44
+    .byte 32
+    .byte 49
+    .byte 53
+    .byte 44
+    .byte 32
+    .byte 49
+    .byte 54
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.6
+.L..main.6:
+    .byte 97
+    .byte 100
+    .byte 100
+    .byte 54
+    .byte 40
+    .byte 49
+    .byte 44
+    .byte 32
+    .byte 50
+    .byte 44
+    .byte 32
+    .byte 97
+    .byte 100
+    .byte 100
+    .byte 54
+    .byte 40
+    .byte 51
+    .byte 44
+    .byte 32
+    .byte 52
+    .byte 44
+    .byte 32
+    .byte 53
+    .byte 44
+    .byte 32
+    .byte 54
+    .byte 44
+    .byte 32
+    .byte 55
+    .byte 44
+    .byte 32
+    .byte 56
+    .byte 41
+    .byte 44
+    .byte 32
+    .byte 57
+    .byte 44
+    .byte 32
+    .byte 49
+    .byte 48
+    .byte 44
+    .byte 32
+    .byte 49
+    .byte 49
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.5
+.L..main.5:
+    .byte 97
+    .byte 100
+    .byte 100
+    .byte 54
+    .byte 40
+    .byte 49
+    .byte 44
+    .byte 32
+    .byte 50
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 44
+    .byte 32
+    .byte 52
+    .byte 44
+    .byte 32
+    .byte 53
+    .byte 44
+    .byte 32
+    .byte 54
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.4
+.L..main.4:
+    .byte 115
+    .byte 117
+    .byte 98
+    .byte 50
+    .byte 40
+    .byte 53
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.3
+.L..main.3:
+    .byte 97
+    .byte 100
+    .byte 100
+    .byte 50
+    .byte 40
+    .byte 51
+    .byte 44
+    .byte 32
+    .byte 53
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.2
+.L..main.2:
+    .byte 99
+    .byte 97
+    .byte 108
+    .byte 108
+    .byte 95
+    .byte 102
+    .byte 105
+    .byte 98
+    .byte 40
+    .byte 49
+    .byte 48
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.1
+.L..main.1:
+    .byte 115
+    .byte 116
+    .byte 97
+    .byte 116
+    .byte 105
+    .byte 99
+    .byte 95
+    .byte 116
+    .byte 119
+    .byte 105
+    .byte 99
+    .byte 101
+    .byte 40
+    .byte 52
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.0
+.L..main.0:
+    .byte 114
+    .byte 101
+    .byte 116
+    .byte 51
+    .byte 40
+    .byte 41
+    .byte 0
+    .global main
+    .text
+main:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 1 81
+   .loc 1 81
+   .loc 1 81
+   .loc 1 81
+    mov $3, %rax
+    push %rax
+   .loc 1 81
+    mov $0, %rax
+    call ret3
+    push %rax
+   .loc 1 81
+    lea .L..main.0(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 82
+   .loc 1 82
+   .loc 1 82
+    mov $8, %rax
+    push %rax
+   .loc 1 82
+   .loc 1 82
+    mov $4, %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call static_twice
+    push %rax
+   .loc 1 82
+    lea .L..main.1(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 83
+   .loc 1 83
+   .loc 1 83
+    mov $89, %rax
+    push %rax
+   .loc 1 83
+   .loc 1 83
+    mov $10, %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call call_fib
+    push %rax
+   .loc 1 83
+    lea .L..main.2(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 84
+   .loc 1 84
+   .loc 1 84
+    mov $8, %rax
+    push %rax
+   .loc 1 84
+   .loc 1 84
+    mov $3, %rax
+    push %rax
+   .loc 1 84
+    mov $5, %rax
+    push %rax
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call add2
+    push %rax
+   .loc 1 84
+    lea .L..main.3(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 85
+   .loc 1 85
+   .loc 1 85
+    mov $2, %rax
+    push %rax
+   .loc 1 85
+   .loc 1 85
+    mov $5, %rax
+    push %rax
+   .loc 1 85
+    mov $3, %rax
+    push %rax
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call sub2
+    push %rax
+   .loc 1 85
+    lea .L..main.4(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 86
+   .loc 1 86
+   .loc 1 86
+    mov $21, %rax
+    push %rax
+   .loc 1 86
+   .loc 1 86
+    mov $1, %rax
+    push %rax
+   .loc 1 86
+    mov $2, %rax
+    push %rax
+   .loc 1 86
+    mov $3, %rax
+    push %rax
+   .loc 1 86
+    mov $4, %rax
+    push %rax
+   .loc 1 86
+    mov $5, %rax
+    push %rax
+   .loc 1 86
+    mov $6, %rax
+    push %rax
+    pop %r9
+    pop %r8
+    pop %rcx
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call add6
+    push %rax
+   .loc 1 86
+    lea .L..main.5(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 87
+   .loc 1 87
+   .loc 1 87
+    mov $66, %rax
+    push %rax
+   .loc 1 87
+   .loc 1 87
+    mov $1, %rax
+    push %rax
+   .loc 1 87
+    mov $2, %rax
+    push %rax
+   .loc 1 87
+   .loc 1 87
+    mov $3, %rax
+    push %rax
+   .loc 1 87
+    mov $4, %rax
+    push %rax
+   .loc 1 87
+    mov $5, %rax
+    push %rax
+   .loc 1 87
+    mov $6, %rax
+    push %rax
+   .loc 1 87
+    mov $7, %rax
+    push %rax
+   .loc 1 87
+    mov $8, %rax
+    push %rax
+    pop %r9
+    pop %r8
+    pop %rcx
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call add6
+    push %rax
+   .loc 1 87
+    mov $9, %rax
+    push %rax
+   .loc 1 87
+    mov $10, %rax
+    push %rax
+   .loc 1 87
+    mov $11, %rax
+    push %rax
+    pop %r9
+    pop %r8
+    pop %rcx
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call add6
+    push %rax
+   .loc 1 87
+    lea .L..main.6(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 88
+   .loc 1 88
+   .loc 1 88
+    mov $136, %rax
+    push %rax
+   .loc 1 88
+   .loc 1 88
+    mov $1, %rax
+    push %rax
+   .loc 1 88
+    mov $2, %rax
+    push %rax
+   .loc 1 88
+   .loc 1 88
+    mov $3, %rax
+    push %rax
+   .loc 1 88
+   .loc 1 88
+    mov $4, %rax
+    push %rax
+   .loc 1 88
+    mov $5, %rax
+    push %rax
+   .loc 1 88
+    mov $6, %rax
+    push %rax
+   .loc 1 88
+    mov $7, %rax
+    push %rax
+   .loc 1 88
+    mov $8, %rax
+    push %rax
+   .loc 1 88
+    mov $9, %rax
+    push %rax
+    pop %r9
+    pop %r8
+    pop %rcx
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call add6
+    push %rax
+   .loc 1 88
+    mov $10, %rax
+    push %rax
+   .loc 1 88
+    mov $11, %rax
+    push %rax
+   .loc 1 88
+    mov $12, %rax
+    push %rax
+   .loc 1 88
+    mov $13, %rax
+    push %rax
+    pop %r9
+    pop %r8
+    pop %rcx
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call add6
+    push %rax
+   .loc 1 88
+    mov $14, %rax
+    push %rax
+   .loc 1 88
+    mov $15, %rax
+    push %rax
+   .loc 1 88
+    mov $16, %rax
+    push %rax
+    pop %r9
+    pop %r8
+    pop %rcx
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call add6
+    push %rax
+   .loc 1 88
+    lea .L..main.7(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 90
+   .loc 1 90
+   .loc 1 90
+    mov $7, %rax
+    push %rax
+   .loc 1 90
+   .loc 1 90
+    mov $3, %rax
+    push %rax
+   .loc 1 90
+    mov $4, %rax
+    push %rax
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call add2
+    push %rax
+   .loc 1 90
+    lea .L..main.8(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 91
+   .loc 1 91
+   .loc 1 91
+    mov $1, %rax
+    push %rax
+   .loc 1 91
+   .loc 1 91
+    mov $4, %rax
+    push %rax
+   .loc 1 91
+    mov $3, %rax
+    push %rax
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call sub2
+    push %rax
+   .loc 1 91
+    lea .L..main.9(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 92
+   .loc 1 92
+   .loc 1 92
+    mov $55, %rax
+    push %rax
+   .loc 1 92
+   .loc 1 92
+    mov $9, %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call fib
+    push %rax
+   .loc 1 92
+    lea .L..main.10(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 94
+   .loc 1 94
+   .loc 1 94
+    mov $1, %rax
+    push %rax
+   .loc 1 94
+   .loc 1 94
+   .loc 1 94
+   .loc 1 94
+    mov $7, %rax
+    push %rax
+   .loc 1 94
+    mov $3, %rax
+    push %rax
+   .loc 1 94
+    mov $3, %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call sub_char
+    push %rax
+   .loc 1 94
+    lea .L..main.11(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 96
+   .loc 1 96
+   .loc 1 96
+    mov $1, %rax
+    push %rax
+   .loc 1 96
+   .loc 1 96
+    mov $7, %rax
+    push %rax
+   .loc 1 96
+    mov $3, %rax
+    push %rax
+   .loc 1 96
+    mov $3, %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call sub_long
+    push %rax
+   .loc 1 96
+    lea .L..main.12(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 98
+   .loc 1 98
+   .loc 1 98
+    mov $1, %rax
+    push %rax
+   .loc 1 98
+   .loc 1 98
+    mov $7, %rax
+    push %rax
+   .loc 1 98
+    mov $3, %rax
+    push %rax
+   .loc 1 98
+    mov $3, %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call sub_short
+    push %rax
+   .loc 1 98
+    lea .L..main.13(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 100
+   .loc 1 100
+    lea g1(%rip), %rax
+    push %rax
+   .loc 1 100
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 101
+   .loc 1 101
+   .loc 1 101
+    mov $3, %rax
+    push %rax
+   .loc 1 101
+   .loc 1 101
+    mov $0, %rax
+    call g1_ptr
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 101
+    lea .L..main.14(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 102
+   .loc 1 102
+   .loc 1 102
+    mov $5, %rax
+    push %rax
+   .loc 1 102
+   .loc 1 102
+    mov $261, %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call int_to_char
+    push %rax
+   .loc 1 102
+    lea .L..main.15(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 104
+   .loc 1 104
+   .loc 1 104
+    lea .L..main.16(%rip), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call printf
+   .loc 1 105
+   .loc 1 105
+    mov $0, %rax
+    jmp .L.return.main
+.L.return.main:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global call_fib
+    .text
+call_fib:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   mov %edi, -4(%rbp)
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call static_fib
+    jmp .L.return.call_fib
+.L.return.call_fib:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .text
+static_twice:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   mov %edi, -4(%rbp)
+   .loc 1 59
+   .loc 1 59
+   .loc 1 59
+   .loc 1 59
+   .loc 1 59
+   .loc 1 59
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 59
+   .loc 1 59
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    jmp .L.return.static_twice
+.L.return.static_twice:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .text
+static_fib:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   mov %edi, -4(%rbp)
+   .loc 1 74
+   .loc 1 74
+   .loc 1 74
+   .loc 1 74
+    mov $1, %rax
+    push %rax
+   .loc 1 74
+   .loc 1 74
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    cmp %edi, %eax
+    setle %al
+    movzb %al, %rax
+    cmp $0, %rax
+    je .L.else.static_fib.1
+   .loc 1 75
+   .loc 1 75
+    mov $1, %rax
+    jmp .L.return.static_fib
+    jmp .L.end.static_fib.1
+.L.else.static_fib.1:
+.L.end.static_fib.1:
+   .loc 1 76
+   .loc 1 76
+   .loc 1 76
+   .loc 1 76
+   .loc 1 76
+   .loc 1 76
+    mov $2, %rax
+    push %rax
+   .loc 1 76
+   .loc 1 76
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    sub %edi, %eax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call static_fib
+    push %rax
+   .loc 1 76
+   .loc 1 76
+   .loc 1 76
+    mov $1, %rax
+    push %rax
+   .loc 1 76
+   .loc 1 76
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    sub %edi, %eax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call static_fib
+    pop %rdi
+    add %edi, %eax
+    jmp .L.return.static_fib
+.L.return.static_fib:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global int_to_char
+    .text
+int_to_char:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   mov %edi, -4(%rbp)
+   .loc 1 54
+   .loc 1 54
+   .loc 1 54
+   .loc 1 54
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+   movsbl %al, %eax
+    jmp .L.return.int_to_char
+.L.return.int_to_char:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global g1_ptr
+    .text
+g1_ptr:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+    lea g1(%rip), %rax
+    jmp .L.return.g1_ptr
+.L.return.g1_ptr:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global sub_long
+    .text
+sub_long:
+    push %rbp
+    mov %rsp, %rbp
+    sub $32, %rsp
+   mov %rdi, -8(%rbp)
+   mov %rsi, -16(%rbp)
+   mov %rdx, -24(%rbp)
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+    lea -24(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+    lea -16(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 48
+   .loc 1 48
+    lea -8(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    sub %rdi, %rax
+    pop %rdi
+    sub %rdi, %rax
+    jmp .L.return.sub_long
+.L.return.sub_long:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global sub_short
+    .text
+sub_short:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   mov %di, -2(%rbp)
+   mov %si, -4(%rbp)
+   mov %dx, -6(%rbp)
+   .loc 1 43
+   .loc 1 43
+   .loc 1 43
+   .loc 1 43
+   .loc 1 43
+   .loc 1 43
+    lea -6(%rbp), %rax
+   movswl (%rax), %eax
+    push %rax
+   .loc 1 43
+   .loc 1 43
+   .loc 1 43
+    lea -4(%rbp), %rax
+   movswl (%rax), %eax
+    push %rax
+   .loc 1 43
+   .loc 1 43
+    lea -2(%rbp), %rax
+   movswl (%rax), %eax
+    pop %rdi
+    sub %edi, %eax
+    pop %rdi
+    sub %edi, %eax
+    jmp .L.return.sub_short
+.L.return.sub_short:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global fib
+    .text
+fib:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   mov %edi, -4(%rbp)
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+    mov $1, %rax
+    push %rax
+   .loc 1 36
+   .loc 1 36
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    cmp %edi, %eax
+    setle %al
+    movzb %al, %rax
+    cmp $0, %rax
+    je .L.else.fib.1
+   .loc 1 37
+   .loc 1 37
+    mov $1, %rax
+    jmp .L.return.fib
+    jmp .L.end.fib.1
+.L.else.fib.1:
+.L.end.fib.1:
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+    mov $2, %rax
+    push %rax
+   .loc 1 38
+   .loc 1 38
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    sub %edi, %eax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call fib
+    push %rax
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+    mov $1, %rax
+    push %rax
+   .loc 1 38
+   .loc 1 38
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    sub %edi, %eax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call fib
+    pop %rdi
+    add %edi, %eax
+    jmp .L.return.fib
+.L.return.fib:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global sub_char
+    .text
+sub_char:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   mov %dil, -1(%rbp)
+   mov %sil, -2(%rbp)
+   mov %dl, -3(%rbp)
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+    lea -3(%rbp), %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+    lea -2(%rbp), %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 31
+   .loc 1 31
+    lea -1(%rbp), %rax
+    movsbl (%rax), %eax
+    pop %rdi
+    sub %edi, %eax
+    pop %rdi
+    sub %edi, %eax
+    jmp .L.return.sub_char
+.L.return.sub_char:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global addx
+    .text
+addx:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   mov %rdi, -8(%rbp)
+   mov %esi, -12(%rbp)
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    lea -12(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 26
+   .loc 1 26
+    lea -8(%rbp), %rax
+    mov (%rax), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    jmp .L.return.addx
+.L.return.addx:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global add6
+    .text
+add6:
+    push %rbp
+    mov %rsp, %rbp
+    sub $32, %rsp
+   mov %edi, -4(%rbp)
+   mov %esi, -8(%rbp)
+   mov %edx, -12(%rbp)
+   mov %ecx, -16(%rbp)
+   mov %r8d, -20(%rbp)
+   mov %r9d, -24(%rbp)
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    lea -24(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    lea -20(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    lea -16(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    lea -12(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    lea -8(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 21
+   .loc 1 21
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    pop %rdi
+    add %edi, %eax
+    pop %rdi
+    add %edi, %eax
+    pop %rdi
+    add %edi, %eax
+    pop %rdi
+    add %edi, %eax
+    jmp .L.return.add6
+.L.return.add6:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global sub2
+    .text
+sub2:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   mov %edi, -4(%rbp)
+   mov %esi, -8(%rbp)
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+    lea -8(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 16
+   .loc 1 16
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    sub %edi, %eax
+    jmp .L.return.sub2
+.L.return.sub2:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global add2
+    .text
+add2:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   mov %edi, -4(%rbp)
+   mov %esi, -8(%rbp)
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    lea -8(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 11
+   .loc 1 11
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    jmp .L.return.add2
+.L.return.add2:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global ret3
+    .text
+ret3:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    mov $3, %rax
+    jmp .L.return.ret3
+   .loc 1 6
+   .loc 1 6
+    mov $5, %rax
+    jmp .L.return.ret3
+.L.return.ret3:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
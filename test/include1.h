@@ -0,0 +1,8 @@
+#ifndef INCLUDE1_H
+#define INCLUDE1_H
+
+int include1() { return 5; }
+
+#include "include2.h"
+
+#endif
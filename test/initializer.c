@@ -0,0 +1,53 @@
+#include "test.h"
+
+int g3 = 3;
+long g4 = sizeof(int) * 4 + 1;
+char g5 = 256 + 5;
+int g6[4] = { 0, 1, 2, 3 };
+int g7[2][3] = { {1, 2, 3}, {4, 5, 6} };
+int g8[4] = { 1, 2, };
+char g9[6] = "abc";
+char g10[2 * 3 - 2];
+struct { char a; int b; long c; } g11 = { 1, 2, 3 };
+union { int a; char b[4]; } g12 = { 16909060 };
+struct { int a[2]; char b; } g13[2] = { {{1, 2}, 3}, {{4, 5}, 6} };
+
+int* g14 = &g3;
+int* g15 = g6 + 2;
+int* g16 = &g7[1][1];
+char* g17 = "hello";
+char* g18 = &g11.a;
+
+int main()
+{
+    ASSERT(3, g3);
+    ASSERT(17, g4);
+    ASSERT(5, g5);
+    ASSERT(0, g6[0]);
+    ASSERT(3, g6[3]);
+    ASSERT(1, g7[0][0]);
+    ASSERT(6, g7[1][2]);
+    ASSERT(2, g8[1]);
+    ASSERT(0, g8[2]);
+    ASSERT(0, g8[3]);
+    ASSERT(99, g9[2]);
+    ASSERT(0, g9[3]);
+    ASSERT(4, sizeof(g10));
+    ASSERT(1, g11.a);
+    ASSERT(2, g11.b);
+    ASSERT(3, g11.c);
+    ASSERT(4, g12.b[0]);
+    ASSERT(1, g12.b[3]);
+    ASSERT(2, g13[0].a[1]);
+    ASSERT(6, g13[1].b);
+
+    ASSERT(3, *g14);
+    ASSERT(2, *g15);
+    ASSERT(5, *g16);
+    ASSERT(108, g17[3]);
+    ASSERT(2, *(int*)(g18 + 4));
+    ASSERT(1, g14 == &g3);
+
+    printf("OK\n");
+    return 0;
+}
@@ -0,0 +1,1057 @@
+.file 1 "test/initializer.c"
+.file 2 "test/test.h"
+    .data
+    .global g18
+g18:
+    .quad g11+0
+    .data
+    .global .L..0
+.L..0:
+    .byte 104
+    .byte 101
+    .byte 108
+    .byte 108
+    .byte 111
+    .byte 0
+    .data
+    .global g17
+g17:
+    .quad .L..0+0
+    .data
+    .global g16
+g16:
+    .quad g7+16
+    .data
+    .global g15
+g15:
+    .quad g6+8
+    .data
+    .global g14
+g14:
+    .quad g3+0
+    .data
+    .global g13
+g13:
+    .byte 1
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 2
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 3
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 4
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 5
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 6
+    .byte 0
+    .byte 0
+    .byte 0
+    .data
+    .global g12
+g12:
+    .byte 4
+    .byte 3
+    .byte 2
+    .byte 1
+    .data
+    .global g11
+g11:
+    .byte 1
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 2
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 3
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .data
+    .global g10
+g10:
+    .zero 4
+    .data
+    .global g9
+g9:
+    .byte 97
+    .byte 98
+    .byte 99
+    .byte 0
+    .byte 0
+    .byte 0
+    .data
+    .global g8
+g8:
+    .byte 1
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 2
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .data
+    .global g7
+g7:
+    .byte 1
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 2
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 3
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 4
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 5
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 6
+    .byte 0
+    .byte 0
+    .byte 0
+    .data
+    .global g6
+g6:
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 1
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 2
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 3
+    .byte 0
+    .byte 0
+    .byte 0
+    .data
+    .global g5
+g5:
+    .byte 5
+    .data
+    .global g4
+g4:
+    .byte 17
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .byte 0
+    .data
+    .global g3
+g3:
+    .byte 3
+    .byte 0
+    .byte 0
+    .byte 0
+    .data
+    .global .L..main.26
+.L..main.26:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+    .data
+    .global .L..main.25
+.L..main.25:
+    .byte 103
+    .byte 49
+    .byte 52
+    .byte 32
+    .byte 61
+    .byte 61
+    .byte 32
+    .byte 38
+    .byte 103
+    .byte 51
+    .byte 0
+    .data
+    .global .L..main.24
+.L..main.24:
+    .byte 42
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 42
+    .byte 41
+    .byte 40
+    .byte 103
+    .byte 49
+    .byte 56
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 52
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.23
+.L..main.23:
+    .byte 103
+    .byte 49
+    .byte 55
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.22
+.L..main.22:
+    .byte 42
+    .byte 103
+    .byte 49
+    .byte 54
+    .byte 0
+    .data
+    .global .L..main.21
+.L..main.21:
+    .byte 42
+    .byte 103
+    .byte 49
+    .byte 53
+    .byte 0
+    .data
+    .global .L..main.20
+.L..main.20:
+    .byte 42
+    .byte 103
+    .byte 49
+    .byte 52
+    .byte 0
+    .data
+    .global .L..main.19
+.L..main.19:
+    .byte 103
+    .byte 49
+    .byte 51
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 46
+    .byte 98
+    .byte 0
+    .data
+    .global .L..main.18
+.L..main.18:
+    .byte 103
+    .byte 49
+    .byte 51
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 46
+    .byte 97
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.17
+.L..main.17:
+    .byte 103
+    .byte 49
+    .byte 50
+    .byte 46
+    .byte 98
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.16
+.L..main.16:
+    .byte 103
+    .byte 49
+    .byte 50
+    .byte 46
+    .byte 98
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.15
+.L..main.15:
+    .byte 103
+    .byte 49
+    .byte 49
+    .byte 46
+    .byte 99
+    .byte 0
+    .data
+    .global .L..main.14
+.L..main.14:
+    .byte 103
+    .byte 49
+    .byte 49
+    .byte 46
+    .byte 98
+    .byte 0
+    .data
+    .global .L..main.13
+.L..main.13:
+    .byte 103
+    .byte 49
+    .byte 49
+    .byte 46
+    .byte 97
+    .byte 0
+    .data
+    .global .L..main.12
+.L..main.12:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 103
+    .byte 49
+    .byte 48
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.11
+.L..main.11:
+    .byte 103
+    .byte 57
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.10
+.L..main.10:
+    .byte 103
+    .byte 57
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.9
+.L..main.9:
+    .byte 103
+    .byte 56
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.8
+.L..main.8:
+    .byte 103
+    .byte 56
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.7
+.L..main.7:
+    .byte 103
+    .byte 56
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.6
+.L..main.6:
+    .byte 103
+    .byte 55
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.5
+.L..main.5:
+    .byte 103
+    .byte 55
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.4
+.L..main.4:
+    .byte 103
+    .byte 54
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.3
+.L..main.3:
+    .byte 103
+    .byte 54
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.2
+.L..main.2:
+    .byte 103
+    .byte 53
+    .byte 0
+    .data
+    .global .L..main.1
+.L..main.1:
+    .byte 103
+    .byte 52
+    .byte 0
+    .data
+    .global .L..main.0
+.L..main.0:
+    .byte 103
+    .byte 51
+    .byte 0
+    .global main
+    .text
+main:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+    mov $3, %rax
+    push %rax
+   .loc 1 23
+    lea g3(%rip), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 23
+    lea .L..main.0(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+    mov $17, %rax
+    push %rax
+   .loc 1 24
+    lea g4(%rip), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 24
+    lea .L..main.1(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+    mov $5, %rax
+    push %rax
+   .loc 1 25
+    lea g5(%rip), %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 25
+    lea .L..main.2(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    mov $0, %rax
+    push %rax
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    lea g6(%rip), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 26
+    lea .L..main.3(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+    mov $3, %rax
+    push %rax
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+    mov $12, %rax
+    push %rax
+   .loc 1 27
+   .loc 1 27
+    lea g6(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 27
+    lea .L..main.4(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    mov $1, %rax
+    push %rax
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    lea g7(%rip), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 28
+    lea .L..main.5(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 29
+   .loc 1 29
+   .loc 1 29
+    mov $6, %rax
+    push %rax
+   .loc 1 29
+   .loc 1 29
+   .loc 1 29
+    mov $8, %rax
+    push %rax
+   .loc 1 29
+   .loc 1 29
+   .loc 1 29
+   .loc 1 29
+    mov $12, %rax
+    push %rax
+   .loc 1 29
+   .loc 1 29
+    lea g7(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 29
+    lea .L..main.6(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+    mov $2, %rax
+    push %rax
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+    mov $4, %rax
+    push %rax
+   .loc 1 30
+   .loc 1 30
+    lea g8(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 30
+    lea .L..main.7(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+    mov $0, %rax
+    push %rax
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+    mov $8, %rax
+    push %rax
+   .loc 1 31
+   .loc 1 31
+    lea g8(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 31
+    lea .L..main.8(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $0, %rax
+    push %rax
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $12, %rax
+    push %rax
+   .loc 1 32
+   .loc 1 32
+    lea g8(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 32
+    lea .L..main.9(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $99, %rax
+    push %rax
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $2, %rax
+    push %rax
+   .loc 1 33
+   .loc 1 33
+    lea g9(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 33
+    lea .L..main.10(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $0, %rax
+    push %rax
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $3, %rax
+    push %rax
+   .loc 1 34
+   .loc 1 34
+    lea g9(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 34
+    lea .L..main.11(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+    mov $4, %rax
+    push %rax
+   .loc 1 35
+    mov $4, %rax
+    push %rax
+   .loc 1 35
+    lea .L..main.12(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+    mov $1, %rax
+    push %rax
+   .loc 1 36
+    lea g11(%rip), %rax
+  add $0, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 36
+    lea .L..main.13(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+    mov $2, %rax
+    push %rax
+   .loc 1 37
+    lea g11(%rip), %rax
+  add $4, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 37
+    lea .L..main.14(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+    mov $3, %rax
+    push %rax
+   .loc 1 38
+    lea g11(%rip), %rax
+  add $8, %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 38
+    lea .L..main.15(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+    mov $4, %rax
+    push %rax
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+    lea g12(%rip), %rax
+  add $0, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 39
+    lea .L..main.16(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    mov $1, %rax
+    push %rax
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    mov $3, %rax
+    push %rax
+   .loc 1 40
+   .loc 1 40
+    lea g12(%rip), %rax
+  add $0, %rax
+    pop %rdi
+    add %rdi, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 40
+    lea .L..main.17(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    mov $2, %rax
+    push %rax
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    mov $4, %rax
+    push %rax
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    lea g13(%rip), %rax
+  add $0, %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 41
+    lea .L..main.18(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 42
+   .loc 1 42
+   .loc 1 42
+    mov $6, %rax
+    push %rax
+   .loc 1 42
+   .loc 1 42
+   .loc 1 42
+    mov $12, %rax
+    push %rax
+   .loc 1 42
+   .loc 1 42
+    lea g13(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+  add $8, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 42
+    lea .L..main.19(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 44
+   .loc 1 44
+   .loc 1 44
+    mov $3, %rax
+    push %rax
+   .loc 1 44
+   .loc 1 44
+    lea g14(%rip), %rax
+    mov (%rax), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 44
+    lea .L..main.20(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+    mov $2, %rax
+    push %rax
+   .loc 1 45
+   .loc 1 45
+    lea g15(%rip), %rax
+    mov (%rax), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 45
+    lea .L..main.21(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 46
+   .loc 1 46
+   .loc 1 46
+    mov $5, %rax
+    push %rax
+   .loc 1 46
+   .loc 1 46
+    lea g16(%rip), %rax
+    mov (%rax), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 46
+    lea .L..main.22(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 47
+   .loc 1 47
+   .loc 1 47
+    mov $108, %rax
+    push %rax
+   .loc 1 47
+   .loc 1 47
+   .loc 1 47
+    mov $3, %rax
+    push %rax
+   .loc 1 47
+    lea g17(%rip), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 47
+    lea .L..main.23(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+    mov $2, %rax
+    push %rax
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+    mov $4, %rax
+    push %rax
+   .loc 1 48
+    lea g18(%rip), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 48
+    lea .L..main.24(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 49
+   .loc 1 49
+   .loc 1 49
+    mov $1, %rax
+    push %rax
+   .loc 1 49
+   .loc 1 49
+    lea g3(%rip), %rax
+    push %rax
+   .loc 1 49
+    lea g14(%rip), %rax
+    mov (%rax), %rax
+    pop %rdi
+    cmp %rdi, %rax
+    sete %al
+    movzb %al, %rax
+    push %rax
+   .loc 1 49
+    lea .L..main.25(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 51
+   .loc 1 51
+   .loc 1 51
+    lea .L..main.26(%rip), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call printf
+   .loc 1 52
+   .loc 1 52
+    mov $0, %rax
+    jmp .L.return.main
+.L.return.main:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
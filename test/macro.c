@@ -0,0 +1,94 @@
+#include "test.h"
+#include "include1.h"
+#include "include1.h"
+#include "include2.h"
+
+int ret3() { return 3; }
+int dbl(int x) { return x * 2; }
+
+#define M1 3
+#define M2(x) (x + 1)
+#define M3(x, y) x * y
+#define M4 M1 + M1
+#define M5(x) #x
+#define M6(x, y) x##y
+#define M7() 11
+#define M8 M8
+#define M9(x) M2(x) * 2
+#define M10 ret
+#define M11(f) f()
+#define M12(x, y) M11(x##y)
+
+#if 0
+#error this is skipped
+int skipped() { return 1; }
+#if 1
+#error nested groups are skipped too
+#endif
+#else
+int not_skipped() { return 2; }
+#endif
+
+#if M1 == 3 && defined(M2) && !defined M99
+int cond1() { return 1; }
+#elif 1
+int cond1() { return 2; }
+#else
+int cond1() { return 3; }
+#endif
+
+#ifdef M99
+int cond2() { return 1; }
+#elif M1 * 2 > 5 || M1 / 0
+int cond2() { return 2; }
+#endif
+
+#ifndef M1
+int cond3() { return 1; }
+#else
+int cond3() { return 3; }
+#endif
+
+#if (1 ? 2 : 3) == 2 && (1 << 4) == 16 && (5 & 3) == 1 && (5 | 3) == 7 && -1 < 0
+int cond4() { return 4; }
+#endif
+
+#define M13 4
+#undef M13
+#ifdef M13
+int cond5() { return 1; }
+#else
+int cond5() { return 5; }
+#endif
+
+int main() {
+    ASSERT(5, include1());
+    ASSERT(7, include2());
+    ASSERT(2, not_skipped());
+    ASSERT(1, cond1());
+    ASSERT(2, cond2());
+    ASSERT(3, cond3());
+    ASSERT(4, cond4());
+    ASSERT(5, cond5());
+
+    ASSERT(3, M1);
+    ASSERT(5, M2(4));
+    ASSERT(7, M3(1 + 2, 3));
+    ASSERT(6, M4);
+    ASSERT(9, M4 * 2);
+    ASSERT(6, sizeof(M5(a + b)));
+    ASSERT(43, M5(a+b)[1]);
+    ASSERT(34, M6(3, 4));
+    ASSERT(11, M7());
+    ASSERT(2, ({ int M8 = 2; M8; }));
+    ASSERT(10, M9(4));
+    ASSERT(3, M6(ret, 3)());
+    ASSERT(3, M12(ret, 3));
+    ASSERT(3, M11(ret3));
+    ASSERT(6, dbl M2((1, 2)));
+    ASSERT(89, __LINE__);
+    ASSERT(13, sizeof(__FILE__));
+
+    printf("OK\n");
+    return 0;
+}
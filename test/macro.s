@@ -0,0 +1,1002 @@
+.file 1 "test/macro.c"
+.file 2 "test/test.h"
+.file 3 "test/include1.h"
+.file 4 "test/include2.h"
+    .data
+    .global .L..main.28
+.L..main.28:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+    .data
+    .global .L..main.27
+.L..main.27:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 95
+    .byte 95
+    .byte 70
+    .byte 73
+    .byte 76
+    .byte 69
+    .byte 95
+    .byte 95
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.26
+.L..main.26:
+    .byte 116
+    .byte 101
+    .byte 115
+    .byte 116
+    .byte 47
+    .byte 109
+    .byte 97
+    .byte 99
+    .byte 114
+    .byte 111
+    .byte 46
+    .byte 99
+    .byte 0
+    .data
+    .global .L..main.25
+.L..main.25:
+    .byte 95
+    .byte 95
+    .byte 76
+    .byte 73
+    .byte 78
+    .byte 69
+    .byte 95
+    .byte 95
+    .byte 0
+    .data
+    .global .L..main.24
+.L..main.24:
+    .byte 100
+    .byte 98
+    .byte 108
+    .byte 32
+    .byte 77
+    .byte 50
+    .byte 40
+    .byte 40
+    .byte 49
+    .byte 44
+    .byte 32
+    .byte 50
+    .byte 41
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.23
+.L..main.23:
+    .byte 77
+    .byte 49
+    .byte 49
+    .byte 40
+    .byte 114
+    .byte 101
+    .byte 116
+    .byte 51
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.22
+.L..main.22:
+    .byte 77
+    .byte 49
+    .byte 50
+    .byte 40
+    .byte 114
+    .byte 101
+    .byte 116
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.21
+.L..main.21:
+    .byte 77
+    .byte 54
+    .byte 40
+    .byte 114
+    .byte 101
+    .byte 116
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 41
+    .byte 40
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.20
+.L..main.20:
+    .byte 77
+    .byte 57
+    .byte 40
+    .byte 52
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.19
+.L..main.19:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 77
+    .byte 56
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 77
+    .byte 56
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.18
+.L..main.18:
+    .byte 77
+    .byte 55
+    .byte 40
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.17
+.L..main.17:
+    .byte 77
+    .byte 54
+    .byte 40
+    .byte 51
+    .byte 44
+    .byte 32
+    .byte 52
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.16
+.L..main.16:
+    .byte 77
+    .byte 53
+    .byte 40
+    .byte 97
+    .byte 43
+    .byte 98
+    .byte 41
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 0
+    .data
+    .global .L..main.15
+.L..main.15:
+    .byte 97
+    .byte 43
+    .byte 98
+    .byte 0
+    .data
+    .global .L..main.14
+.L..main.14:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 77
+    .byte 53
+    .byte 40
+    .byte 97
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 98
+    .byte 41
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.13
+.L..main.13:
+    .byte 97
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 98
+    .byte 0
+    .data
+    .global .L..main.12
+.L..main.12:
+    .byte 77
+    .byte 52
+    .byte 32
+    .byte 42
+    .byte 32
+    .byte 50
+    .byte 0
+    .data
+    .global .L..main.11
+.L..main.11:
+    .byte 77
+    .byte 52
+    .byte 0
+    .data
+    .global .L..main.10
+.L..main.10:
+    .byte 77
+    .byte 51
+    .byte 40
+    .byte 49
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 50
+    .byte 44
+    .byte 32
+    .byte 51
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.9
+.L..main.9:
+    .byte 77
+    .byte 50
+    .byte 40
+    .byte 52
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.8
+.L..main.8:
+    .byte 77
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.7
+.L..main.7:
+    .byte 99
+    .byte 111
+    .byte 110
+    .byte 100
+    .byte 53
+    .byte 40
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.6
+.L..main.6:
+    .byte 99
+    .byte 111
+    .byte 110
+    .byte 100
+    .byte 52
+    .byte 40
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.5
+.L..main.5:
+    .byte 99
+    .byte 111
+    .byte 110
+    .byte 100
+    .byte 51
+    .byte 40
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.4
+.L..main.4:
+    .byte 99
+    .byte 111
+    .byte 110
+    .byte 100
+    .byte 50
+    .byte 40
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.3
+.L..main.3:
+    .byte 99
+    .byte 111
+    .byte 110
+    .byte 100
+    .byte 49
+    .byte 40
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.2
+.L..main.2:
+    .byte 110
+    .byte 111
+    .byte 116
+    .byte 95
+    .byte 115
+    .byte 107
+    .byte 105
+    .byte 112
+    .byte 112
+    .byte 101
+    .byte 100
+    .byte 40
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.1
+.L..main.1:
+    .byte 105
+    .byte 110
+    .byte 99
+    .byte 108
+    .byte 117
+    .byte 100
+    .byte 101
+    .byte 50
+    .byte 40
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.0
+.L..main.0:
+    .byte 105
+    .byte 110
+    .byte 99
+    .byte 108
+    .byte 117
+    .byte 100
+    .byte 101
+    .byte 49
+    .byte 40
+    .byte 41
+    .byte 0
+    .global main
+    .text
+main:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   .loc 1 65
+   .loc 1 65
+   .loc 1 65
+   .loc 1 65
+    mov $5, %rax
+    push %rax
+   .loc 1 65
+    mov $0, %rax
+    call include1
+    push %rax
+   .loc 1 65
+    lea .L..main.0(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 66
+   .loc 1 66
+   .loc 1 66
+    mov $7, %rax
+    push %rax
+   .loc 1 66
+    mov $0, %rax
+    call include2
+    push %rax
+   .loc 1 66
+    lea .L..main.1(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 67
+   .loc 1 67
+   .loc 1 67
+    mov $2, %rax
+    push %rax
+   .loc 1 67
+    mov $0, %rax
+    call not_skipped
+    push %rax
+   .loc 1 67
+    lea .L..main.2(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 68
+   .loc 1 68
+   .loc 1 68
+    mov $1, %rax
+    push %rax
+   .loc 1 68
+    mov $0, %rax
+    call cond1
+    push %rax
+   .loc 1 68
+    lea .L..main.3(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+    mov $2, %rax
+    push %rax
+   .loc 1 69
+    mov $0, %rax
+    call cond2
+    push %rax
+   .loc 1 69
+    lea .L..main.4(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 70
+   .loc 1 70
+   .loc 1 70
+    mov $3, %rax
+    push %rax
+   .loc 1 70
+    mov $0, %rax
+    call cond3
+    push %rax
+   .loc 1 70
+    lea .L..main.5(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 71
+   .loc 1 71
+   .loc 1 71
+    mov $4, %rax
+    push %rax
+   .loc 1 71
+    mov $0, %rax
+    call cond4
+    push %rax
+   .loc 1 71
+    lea .L..main.6(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 72
+   .loc 1 72
+   .loc 1 72
+    mov $5, %rax
+    push %rax
+   .loc 1 72
+    mov $0, %rax
+    call cond5
+    push %rax
+   .loc 1 72
+    lea .L..main.7(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 74
+   .loc 1 74
+   .loc 1 74
+    mov $3, %rax
+    push %rax
+   .loc 1 74
+    mov $3, %rax
+    push %rax
+   .loc 1 74
+    lea .L..main.8(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 75
+   .loc 1 75
+   .loc 1 75
+    mov $5, %rax
+    push %rax
+   .loc 1 75
+    mov $5, %rax
+    push %rax
+   .loc 1 75
+    lea .L..main.9(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 76
+   .loc 1 76
+   .loc 1 76
+    mov $7, %rax
+    push %rax
+   .loc 1 76
+    mov $7, %rax
+    push %rax
+   .loc 1 76
+    lea .L..main.10(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 77
+   .loc 1 77
+   .loc 1 77
+    mov $6, %rax
+    push %rax
+   .loc 1 77
+    mov $6, %rax
+    push %rax
+   .loc 1 77
+    lea .L..main.11(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 78
+   .loc 1 78
+   .loc 1 78
+    mov $9, %rax
+    push %rax
+   .loc 1 78
+    mov $9, %rax
+    push %rax
+   .loc 1 78
+    lea .L..main.12(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 79
+   .loc 1 79
+   .loc 1 79
+    mov $6, %rax
+    push %rax
+   .loc 1 79
+    mov $6, %rax
+    push %rax
+   .loc 1 79
+    lea .L..main.14(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 80
+   .loc 1 80
+   .loc 1 80
+    mov $43, %rax
+    push %rax
+   .loc 1 80
+   .loc 1 80
+   .loc 1 80
+    mov $1, %rax
+    push %rax
+   .loc 1 80
+   .loc 1 80
+    lea .L..main.15(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 80
+    lea .L..main.16(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 81
+   .loc 1 81
+   .loc 1 81
+    mov $34, %rax
+    push %rax
+   .loc 1 81
+    mov $34, %rax
+    push %rax
+   .loc 1 81
+    lea .L..main.17(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 82
+   .loc 1 82
+   .loc 1 82
+    mov $11, %rax
+    push %rax
+   .loc 1 82
+    mov $11, %rax
+    push %rax
+   .loc 1 82
+    lea .L..main.18(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 83
+   .loc 1 83
+   .loc 1 83
+    mov $2, %rax
+    push %rax
+   .loc 1 83
+   .loc 1 83
+   .loc 1 83
+   .loc 1 83
+    lea -4(%rbp), %rax
+    push %rax
+   .loc 1 83
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 83
+   .loc 1 83
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 83
+    lea .L..main.19(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 84
+   .loc 1 84
+   .loc 1 84
+    mov $10, %rax
+    push %rax
+   .loc 1 84
+    mov $10, %rax
+    push %rax
+   .loc 1 84
+    lea .L..main.20(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 85
+   .loc 1 85
+   .loc 1 85
+    mov $3, %rax
+    push %rax
+   .loc 1 85
+    mov $0, %rax
+    call ret3
+    push %rax
+   .loc 1 85
+    lea .L..main.21(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 86
+   .loc 1 86
+   .loc 1 86
+    mov $3, %rax
+    push %rax
+   .loc 1 86
+    mov $0, %rax
+    call ret3
+    push %rax
+   .loc 1 86
+    lea .L..main.22(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 87
+   .loc 1 87
+   .loc 1 87
+    mov $3, %rax
+    push %rax
+   .loc 1 87
+    mov $0, %rax
+    call ret3
+    push %rax
+   .loc 1 87
+    lea .L..main.23(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 88
+   .loc 1 88
+   .loc 1 88
+    mov $6, %rax
+    push %rax
+   .loc 1 88
+   .loc 1 88
+   .loc 1 88
+    mov $1, %rax
+    push %rax
+   .loc 1 88
+   .loc 1 88
+    mov $1, %rax
+   .loc 1 88
+    mov $2, %rax
+    pop %rdi
+    add %edi, %eax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call dbl
+    push %rax
+   .loc 1 88
+    lea .L..main.24(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 89
+   .loc 1 89
+   .loc 1 89
+    mov $89, %rax
+    push %rax
+   .loc 1 89
+    mov $89, %rax
+    push %rax
+   .loc 1 89
+    lea .L..main.25(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 90
+   .loc 1 90
+   .loc 1 90
+    mov $13, %rax
+    push %rax
+   .loc 1 90
+    mov $13, %rax
+    push %rax
+   .loc 1 90
+    lea .L..main.27(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 92
+   .loc 1 92
+   .loc 1 92
+    lea .L..main.28(%rip), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call printf
+   .loc 1 93
+   .loc 1 93
+    mov $0, %rax
+    jmp .L.return.main
+.L.return.main:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global cond5
+    .text
+cond5:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 1 61
+   .loc 1 61
+   .loc 1 61
+    mov $5, %rax
+    jmp .L.return.cond5
+.L.return.cond5:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global cond4
+    .text
+cond4:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+    mov $4, %rax
+    jmp .L.return.cond4
+.L.return.cond4:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global cond3
+    .text
+cond3:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 1 49
+   .loc 1 49
+   .loc 1 49
+    mov $3, %rax
+    jmp .L.return.cond3
+.L.return.cond3:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global cond2
+    .text
+cond2:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 1 43
+   .loc 1 43
+   .loc 1 43
+    mov $2, %rax
+    jmp .L.return.cond2
+.L.return.cond2:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global cond1
+    .text
+cond1:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $1, %rax
+    jmp .L.return.cond1
+.L.return.cond1:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global not_skipped
+    .text
+not_skipped:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 1 29
+   .loc 1 29
+   .loc 1 29
+    mov $2, %rax
+    jmp .L.return.not_skipped
+.L.return.not_skipped:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global dbl
+    .text
+dbl:
+    push %rbp
+    mov %rsp, %rbp
+    sub $16, %rsp
+   mov %edi, -4(%rbp)
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    mov $2, %rax
+    push %rax
+   .loc 1 7
+   .loc 1 7
+    lea -4(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    imul %edi, %eax
+    jmp .L.return.dbl
+.L.return.dbl:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global ret3
+    .text
+ret3:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    mov $3, %rax
+    jmp .L.return.ret3
+.L.return.ret3:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global include2
+    .text
+include2:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 4 3
+   .loc 4 3
+   .loc 4 3
+    mov $7, %rax
+    jmp .L.return.include2
+.L.return.include2:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
+    .global include1
+    .text
+include1:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 3 4
+   .loc 3 4
+   .loc 3 4
+    mov $5, %rax
+    jmp .L.return.include1
+.L.return.include1:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
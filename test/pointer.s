@@ -0,0 +1,3218 @@
+.file 1 "test/pointer.c"
+.file 2 "test/test.h"
+    .data
+    .global .L..main.32
+.L..main.32:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+    .data
+    .global .L..main.31
+.L..main.31:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 91
+    .byte 53
+    .byte 93
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.30
+.L..main.30:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 61
+    .byte 52
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.29
+.L..main.29:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.28
+.L..main.28:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 61
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.27
+.L..main.27:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 61
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.26
+.L..main.26:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 61
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.25
+.L..main.25:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 61
+    .byte 52
+    .byte 59
+    .byte 32
+    .byte 50
+    .byte 91
+    .byte 120
+    .byte 93
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 50
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.24
+.L..main.24:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 61
+    .byte 52
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 50
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.23
+.L..main.23:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 61
+    .byte 52
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 50
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.22
+.L..main.22:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 61
+    .byte 52
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.21
+.L..main.21:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 61
+    .byte 52
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.20
+.L..main.20:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 121
+    .byte 43
+    .byte 53
+    .byte 41
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 43
+    .byte 50
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.19
+.L..main.19:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 121
+    .byte 43
+    .byte 52
+    .byte 41
+    .byte 61
+    .byte 52
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.18
+.L..main.18:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 121
+    .byte 43
+    .byte 51
+    .byte 41
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.17
+.L..main.17:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 121
+    .byte 43
+    .byte 50
+    .byte 41
+    .byte 61
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 42
+    .byte 120
+    .byte 43
+    .byte 50
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.16
+.L..main.16:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 121
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 61
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 42
+    .byte 120
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.15
+.L..main.15:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 42
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.14
+.L..main.14:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 61
+    .byte 52
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 50
+    .byte 41
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 50
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.13
+.L..main.13:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 61
+    .byte 52
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 50
+    .byte 41
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.12
+.L..main.12:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 61
+    .byte 52
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 120
+    .byte 43
+    .byte 50
+    .byte 41
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.11
+.L..main.11:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 38
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.10
+.L..main.10:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 44
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 43
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.9
+.L..main.9:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 44
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 43
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.8
+.L..main.8:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 40
+    .byte 38
+    .byte 120
+    .byte 43
+    .byte 50
+    .byte 41
+    .byte 45
+    .byte 38
+    .byte 120
+    .byte 43
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.7
+.L..main.7:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 38
+    .byte 121
+    .byte 45
+    .byte 50
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 61
+    .byte 55
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.6
+.L..main.6:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 38
+    .byte 120
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 61
+    .byte 55
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.5
+.L..main.5:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 38
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.4
+.L..main.4:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 38
+    .byte 120
+    .byte 45
+    .byte 40
+    .byte 45
+    .byte 49
+    .byte 41
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.3
+.L..main.3:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 38
+    .byte 121
+    .byte 45
+    .byte 49
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.2
+.L..main.2:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 40
+    .byte 38
+    .byte 120
+    .byte 43
+    .byte 49
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.1
+.L..main.1:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 61
+    .byte 38
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 42
+    .byte 122
+    .byte 61
+    .byte 38
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 42
+    .byte 122
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.0
+.L..main.0:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 38
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .global main
+    .text
+main:
+    push %rbp
+    mov %rsp, %rbp
+    sub $608, %rsp
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    mov $3, %rax
+    push %rax
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    lea -608(%rbp), %rax
+    push %rax
+   .loc 1 5
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    lea -608(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 5
+    lea .L..main.0(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    mov $3, %rax
+    push %rax
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    lea -604(%rbp), %rax
+    push %rax
+   .loc 1 6
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    lea -600(%rbp), %rax
+    push %rax
+   .loc 1 6
+   .loc 1 6
+    lea -604(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    lea -592(%rbp), %rax
+    push %rax
+   .loc 1 6
+   .loc 1 6
+    lea -600(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    lea -592(%rbp), %rax
+    mov (%rax), %rax
+    mov (%rax), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 6
+    lea .L..main.1(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    mov $5, %rax
+    push %rax
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    lea -580(%rbp), %rax
+    push %rax
+   .loc 1 7
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    lea -576(%rbp), %rax
+    push %rax
+   .loc 1 7
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    mov $4, %rax
+    push %rax
+   .loc 1 7
+    lea -580(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 7
+    lea .L..main.2(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    mov $3, %rax
+    push %rax
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    lea -572(%rbp), %rax
+    push %rax
+   .loc 1 8
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    lea -568(%rbp), %rax
+    push %rax
+   .loc 1 8
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    mov $4, %rax
+    push %rax
+   .loc 1 8
+    lea -568(%rbp), %rax
+    pop %rdi
+    sub %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 8
+    lea .L..main.3(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    mov $5, %rax
+    push %rax
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    lea -564(%rbp), %rax
+    push %rax
+   .loc 1 9
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    lea -560(%rbp), %rax
+    push %rax
+   .loc 1 9
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    mov $-4, %rax
+    push %rax
+   .loc 1 9
+    lea -564(%rbp), %rax
+    pop %rdi
+    sub %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 9
+    lea .L..main.4(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    mov $5, %rax
+    push %rax
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    lea -556(%rbp), %rax
+    push %rax
+   .loc 1 10
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    lea -552(%rbp), %rax
+    push %rax
+   .loc 1 10
+   .loc 1 10
+    lea -556(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    lea -552(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 10
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 10
+   .loc 1 10
+    lea -556(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 10
+    lea .L..main.5(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    mov $7, %rax
+    push %rax
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    lea -540(%rbp), %rax
+    push %rax
+   .loc 1 11
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    lea -536(%rbp), %rax
+    push %rax
+   .loc 1 11
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    mov $4, %rax
+    push %rax
+   .loc 1 11
+    lea -540(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 11
+    mov $7, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 11
+   .loc 1 11
+    lea -536(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 11
+    lea .L..main.6(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    mov $7, %rax
+    push %rax
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea -532(%rbp), %rax
+    push %rax
+   .loc 1 12
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea -528(%rbp), %rax
+    push %rax
+   .loc 1 12
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    mov $4, %rax
+    push %rax
+   .loc 1 12
+   .loc 1 12
+    mov $8, %rax
+    push %rax
+   .loc 1 12
+    lea -528(%rbp), %rax
+    pop %rdi
+    sub %rdi, %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 12
+    mov $7, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 12
+   .loc 1 12
+    lea -532(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 12
+    lea .L..main.7(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    mov $5, %rax
+    push %rax
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    lea -524(%rbp), %rax
+    push %rax
+   .loc 1 13
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    mov $3, %rax
+    push %rax
+   .loc 1 13
+   .loc 1 13
+    mov $4, %rax
+    push %rax
+   .loc 1 13
+   .loc 1 13
+    lea -524(%rbp), %rax
+    push %rax
+   .loc 1 13
+   .loc 1 13
+    mov $8, %rax
+    push %rax
+   .loc 1 13
+    lea -524(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    pop %rdi
+    sub %rdi, %rax
+    pop %rdi
+   cdq
+    idiv %edi
+    pop %rdi
+    add %edi, %eax
+    push %rax
+   .loc 1 13
+    lea .L..main.8(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    mov $8, %rax
+    push %rax
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    lea -520(%rbp), %rax
+    push %rax
+   .loc 1 14
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 14
+   .loc 1 14
+    lea -516(%rbp), %rax
+    push %rax
+   .loc 1 14
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    lea -516(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 14
+    lea -520(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    push %rax
+   .loc 1 14
+    lea .L..main.9(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+    mov $8, %rax
+    push %rax
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+    lea -512(%rbp), %rax
+    push %rax
+   .loc 1 15
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 15
+   .loc 1 15
+    lea -508(%rbp), %rax
+    push %rax
+   .loc 1 15
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+    lea -508(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 15
+    lea -512(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    push %rax
+   .loc 1 15
+    lea .L..main.10(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    mov $3, %rax
+    push %rax
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    lea -496(%rbp), %rax
+    push %rax
+   .loc 1 17
+   .loc 1 17
+    lea -504(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    lea -496(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 17
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    lea -504(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 17
+    lea .L..main.11(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+    mov $3, %rax
+    push %rax
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+    lea -484(%rbp), %rax
+    push %rax
+   .loc 1 19
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+    mov $4, %rax
+    push %rax
+   .loc 1 19
+   .loc 1 19
+    lea -484(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 19
+    mov $4, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+    mov $8, %rax
+    push %rax
+   .loc 1 19
+   .loc 1 19
+    lea -484(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 19
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+    lea -484(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 19
+    lea .L..main.12(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+    mov $4, %rax
+    push %rax
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+    lea -472(%rbp), %rax
+    push %rax
+   .loc 1 20
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+    mov $4, %rax
+    push %rax
+   .loc 1 20
+   .loc 1 20
+    lea -472(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 20
+    mov $4, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+    mov $8, %rax
+    push %rax
+   .loc 1 20
+   .loc 1 20
+    lea -472(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 20
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+    mov $4, %rax
+    push %rax
+   .loc 1 20
+   .loc 1 20
+    lea -472(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 20
+    lea .L..main.13(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    mov $5, %rax
+    push %rax
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    lea -460(%rbp), %rax
+    push %rax
+   .loc 1 21
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    mov $4, %rax
+    push %rax
+   .loc 1 21
+   .loc 1 21
+    lea -460(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 21
+    mov $4, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    mov $8, %rax
+    push %rax
+   .loc 1 21
+   .loc 1 21
+    lea -460(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 21
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    mov $8, %rax
+    push %rax
+   .loc 1 21
+   .loc 1 21
+    lea -460(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 21
+    lea .L..main.14(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+    mov $0, %rax
+    push %rax
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+    lea -424(%rbp), %rax
+    push %rax
+   .loc 1 23
+   .loc 1 23
+    lea -448(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+    lea -424(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 23
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+    lea -448(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 23
+    lea .L..main.15(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+    mov $1, %rax
+    push %rax
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+    lea -392(%rbp), %rax
+    push %rax
+   .loc 1 24
+   .loc 1 24
+    lea -416(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+    mov $4, %rax
+    push %rax
+   .loc 1 24
+    lea -392(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 24
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+    mov $4, %rax
+    push %rax
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+    lea -416(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 24
+    lea .L..main.16(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+    mov $2, %rax
+    push %rax
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+    lea -360(%rbp), %rax
+    push %rax
+   .loc 1 25
+   .loc 1 25
+    lea -384(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+    mov $8, %rax
+    push %rax
+   .loc 1 25
+    lea -360(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 25
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+    mov $8, %rax
+    push %rax
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+    lea -384(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 25
+    lea .L..main.17(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    mov $3, %rax
+    push %rax
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    lea -328(%rbp), %rax
+    push %rax
+   .loc 1 26
+   .loc 1 26
+    lea -352(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    mov $12, %rax
+    push %rax
+   .loc 1 26
+    lea -328(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 26
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    mov $12, %rax
+    push %rax
+   .loc 1 26
+   .loc 1 26
+    lea -352(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 26
+    lea .L..main.18(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+    mov $4, %rax
+    push %rax
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+    lea -296(%rbp), %rax
+    push %rax
+   .loc 1 27
+   .loc 1 27
+    lea -320(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+    mov $16, %rax
+    push %rax
+   .loc 1 27
+    lea -296(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 27
+    mov $4, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+    mov $4, %rax
+    push %rax
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+    mov $12, %rax
+    push %rax
+   .loc 1 27
+   .loc 1 27
+    lea -320(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 27
+    lea .L..main.19(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    mov $5, %rax
+    push %rax
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    lea -264(%rbp), %rax
+    push %rax
+   .loc 1 28
+   .loc 1 28
+    lea -288(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    mov $20, %rax
+    push %rax
+   .loc 1 28
+    lea -264(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 28
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    mov $8, %rax
+    push %rax
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    mov $12, %rax
+    push %rax
+   .loc 1 28
+   .loc 1 28
+    lea -288(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 28
+    lea .L..main.20(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+    mov $3, %rax
+    push %rax
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+    lea -252(%rbp), %rax
+    push %rax
+   .loc 1 30
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+    mov $4, %rax
+    push %rax
+   .loc 1 30
+   .loc 1 30
+    lea -252(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 30
+    mov $4, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+    mov $8, %rax
+    push %rax
+   .loc 1 30
+   .loc 1 30
+    lea -252(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 30
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+    lea -252(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 30
+    lea .L..main.21(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+    mov $4, %rax
+    push %rax
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+    lea -240(%rbp), %rax
+    push %rax
+   .loc 1 31
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+    mov $4, %rax
+    push %rax
+   .loc 1 31
+   .loc 1 31
+    lea -240(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 31
+    mov $4, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+    mov $8, %rax
+    push %rax
+   .loc 1 31
+   .loc 1 31
+    lea -240(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 31
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+    mov $4, %rax
+    push %rax
+   .loc 1 31
+   .loc 1 31
+    lea -240(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 31
+    lea .L..main.22(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $5, %rax
+    push %rax
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    lea -228(%rbp), %rax
+    push %rax
+   .loc 1 32
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $4, %rax
+    push %rax
+   .loc 1 32
+   .loc 1 32
+    lea -228(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 32
+    mov $4, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $8, %rax
+    push %rax
+   .loc 1 32
+   .loc 1 32
+    lea -228(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 32
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $8, %rax
+    push %rax
+   .loc 1 32
+   .loc 1 32
+    lea -228(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 32
+    lea .L..main.23(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $5, %rax
+    push %rax
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    lea -216(%rbp), %rax
+    push %rax
+   .loc 1 33
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $4, %rax
+    push %rax
+   .loc 1 33
+   .loc 1 33
+    lea -216(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 33
+    mov $4, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $8, %rax
+    push %rax
+   .loc 1 33
+   .loc 1 33
+    lea -216(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 33
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $8, %rax
+    push %rax
+   .loc 1 33
+   .loc 1 33
+    lea -216(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 33
+    lea .L..main.24(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $5, %rax
+    push %rax
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    lea -204(%rbp), %rax
+    push %rax
+   .loc 1 34
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $4, %rax
+    push %rax
+   .loc 1 34
+   .loc 1 34
+    lea -204(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 34
+    mov $4, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $8, %rax
+    push %rax
+   .loc 1 34
+   .loc 1 34
+    lea -204(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 34
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $8, %rax
+    push %rax
+   .loc 1 34
+   .loc 1 34
+    lea -204(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 34
+    lea .L..main.25(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+    mov $0, %rax
+    push %rax
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+    lea -168(%rbp), %rax
+    push %rax
+   .loc 1 36
+   .loc 1 36
+    lea -192(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+    lea -168(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 36
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+    lea -192(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 36
+    lea .L..main.26(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+    mov $1, %rax
+    push %rax
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+    lea -136(%rbp), %rax
+    push %rax
+   .loc 1 37
+   .loc 1 37
+    lea -160(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+    mov $4, %rax
+    push %rax
+   .loc 1 37
+    lea -136(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 37
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+    mov $4, %rax
+    push %rax
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+    lea -160(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 37
+    lea .L..main.27(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+    mov $2, %rax
+    push %rax
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+    lea -104(%rbp), %rax
+    push %rax
+   .loc 1 38
+   .loc 1 38
+    lea -128(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+    mov $8, %rax
+    push %rax
+   .loc 1 38
+    lea -104(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 38
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+    mov $8, %rax
+    push %rax
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+    lea -128(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 38
+    lea .L..main.28(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+    mov $3, %rax
+    push %rax
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+    lea -72(%rbp), %rax
+    push %rax
+   .loc 1 39
+   .loc 1 39
+    lea -96(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+    mov $12, %rax
+    push %rax
+   .loc 1 39
+    lea -72(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 39
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+    mov $12, %rax
+    push %rax
+   .loc 1 39
+   .loc 1 39
+    lea -96(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 39
+    lea .L..main.29(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    mov $4, %rax
+    push %rax
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    lea -40(%rbp), %rax
+    push %rax
+   .loc 1 40
+   .loc 1 40
+    lea -64(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    mov $16, %rax
+    push %rax
+   .loc 1 40
+    lea -40(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 40
+    mov $4, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    mov $4, %rax
+    push %rax
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    mov $12, %rax
+    push %rax
+   .loc 1 40
+   .loc 1 40
+    lea -64(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 40
+    lea .L..main.30(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    mov $5, %rax
+    push %rax
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    lea -8(%rbp), %rax
+    push %rax
+   .loc 1 41
+   .loc 1 41
+    lea -32(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    mov $20, %rax
+    push %rax
+   .loc 1 41
+    lea -8(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 41
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    mov $8, %rax
+    push %rax
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    mov $12, %rax
+    push %rax
+   .loc 1 41
+   .loc 1 41
+    lea -32(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 41
+    lea .L..main.31(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 43
+   .loc 1 43
+   .loc 1 43
+    lea .L..main.32(%rip), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call printf
+   .loc 1 44
+   .loc 1 44
+    mov $0, %rax
+    jmp .L.return.main
+.L.return.main:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
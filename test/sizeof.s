@@ -0,0 +1,961 @@
+.file 1 "test/sizeof.c"
+.file 2 "test/test.h"
+    .data
+    .global .L..main.25
+.L..main.25:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+    .data
+    .global .L..main.24
+.L..main.24:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 41
+    .byte 45
+    .byte 49
+    .byte 48
+    .byte 32
+    .byte 47
+    .byte 32
+    .byte 53
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.23
+.L..main.23:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 41
+    .byte 45
+    .byte 49
+    .byte 48
+    .byte 32
+    .byte 42
+    .byte 32
+    .byte 53
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.22
+.L..main.22:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 41
+    .byte 45
+    .byte 49
+    .byte 48
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 53
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.21
+.L..main.21:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 41
+    .byte 45
+    .byte 49
+    .byte 48
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 53
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.20
+.L..main.20:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 45
+    .byte 49
+    .byte 48
+    .byte 32
+    .byte 47
+    .byte 32
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 41
+    .byte 53
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.19
+.L..main.19:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 45
+    .byte 49
+    .byte 48
+    .byte 32
+    .byte 42
+    .byte 32
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 41
+    .byte 53
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.18
+.L..main.18:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 45
+    .byte 49
+    .byte 48
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 41
+    .byte 53
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.17
+.L..main.17:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 45
+    .byte 49
+    .byte 48
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 41
+    .byte 53
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.16
+.L..main.16:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.15
+.L..main.15:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.14
+.L..main.14:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.13
+.L..main.13:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 42
+    .byte 32
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.12
+.L..main.12:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 40
+    .byte 42
+    .byte 41
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.11
+.L..main.11:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 42
+    .byte 42
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.10
+.L..main.10:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 42
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.9
+.L..main.9:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 42
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.8
+.L..main.8:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 42
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.7
+.L..main.7:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.6
+.L..main.6:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.5
+.L..main.5:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.4
+.L..main.4:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.3
+.L..main.3:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 115
+    .byte 104
+    .byte 111
+    .byte 114
+    .byte 116
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.2
+.L..main.2:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 115
+    .byte 104
+    .byte 111
+    .byte 114
+    .byte 116
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.1
+.L..main.1:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 115
+    .byte 104
+    .byte 111
+    .byte 114
+    .byte 116
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.0
+.L..main.0:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 41
+    .byte 0
+    .global main
+    .text
+main:
+    push %rbp
+    mov %rsp, %rbp
+    sub $0, %rsp
+   .loc 1 4
+   .loc 1 4
+   .loc 1 4
+   .loc 1 4
+    mov $1, %rax
+    push %rax
+   .loc 1 4
+    mov $1, %rax
+    push %rax
+   .loc 1 4
+    lea .L..main.0(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    mov $2, %rax
+    push %rax
+   .loc 1 5
+    mov $2, %rax
+    push %rax
+   .loc 1 5
+    lea .L..main.1(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    mov $2, %rax
+    push %rax
+   .loc 1 6
+    mov $2, %rax
+    push %rax
+   .loc 1 6
+    lea .L..main.2(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    mov $2, %rax
+    push %rax
+   .loc 1 7
+    mov $2, %rax
+    push %rax
+   .loc 1 7
+    lea .L..main.3(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    mov $4, %rax
+    push %rax
+   .loc 1 8
+    mov $4, %rax
+    push %rax
+   .loc 1 8
+    lea .L..main.4(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    mov $8, %rax
+    push %rax
+   .loc 1 9
+    mov $8, %rax
+    push %rax
+   .loc 1 9
+    lea .L..main.5(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    mov $8, %rax
+    push %rax
+   .loc 1 10
+    mov $8, %rax
+    push %rax
+   .loc 1 10
+    lea .L..main.6(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    mov $8, %rax
+    push %rax
+   .loc 1 11
+    mov $8, %rax
+    push %rax
+   .loc 1 11
+    lea .L..main.7(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    mov $8, %rax
+    push %rax
+   .loc 1 12
+    mov $8, %rax
+    push %rax
+   .loc 1 12
+    lea .L..main.8(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    mov $8, %rax
+    push %rax
+   .loc 1 13
+    mov $8, %rax
+    push %rax
+   .loc 1 13
+    lea .L..main.9(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    mov $8, %rax
+    push %rax
+   .loc 1 14
+    mov $8, %rax
+    push %rax
+   .loc 1 14
+    lea .L..main.10(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+    mov $8, %rax
+    push %rax
+   .loc 1 15
+    mov $8, %rax
+    push %rax
+   .loc 1 15
+    lea .L..main.11(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+    mov $8, %rax
+    push %rax
+   .loc 1 16
+    mov $8, %rax
+    push %rax
+   .loc 1 16
+    lea .L..main.12(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    mov $32, %rax
+    push %rax
+   .loc 1 17
+    mov $32, %rax
+    push %rax
+   .loc 1 17
+    lea .L..main.13(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 18
+   .loc 1 18
+   .loc 1 18
+    mov $16, %rax
+    push %rax
+   .loc 1 18
+    mov $16, %rax
+    push %rax
+   .loc 1 18
+    lea .L..main.14(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+    mov $48, %rax
+    push %rax
+   .loc 1 19
+    mov $48, %rax
+    push %rax
+   .loc 1 19
+    lea .L..main.15(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+    mov $8, %rax
+    push %rax
+   .loc 1 20
+    mov $8, %rax
+    push %rax
+   .loc 1 20
+    lea .L..main.16(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    mov $8, %rax
+    push %rax
+   .loc 1 21
+    mov $8, %rax
+    push %rax
+   .loc 1 21
+    lea .L..main.17(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 22
+   .loc 1 22
+   .loc 1 22
+    mov $8, %rax
+    push %rax
+   .loc 1 22
+    mov $8, %rax
+    push %rax
+   .loc 1 22
+    lea .L..main.18(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+    mov $8, %rax
+    push %rax
+   .loc 1 23
+    mov $8, %rax
+    push %rax
+   .loc 1 23
+    lea .L..main.19(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+    mov $8, %rax
+    push %rax
+   .loc 1 24
+    mov $8, %rax
+    push %rax
+   .loc 1 24
+    lea .L..main.20(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+    mov $8, %rax
+    push %rax
+   .loc 1 25
+    mov $8, %rax
+    push %rax
+   .loc 1 25
+    lea .L..main.21(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    mov $8, %rax
+    push %rax
+   .loc 1 26
+    mov $8, %rax
+    push %rax
+   .loc 1 26
+    lea .L..main.22(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+    mov $8, %rax
+    push %rax
+   .loc 1 27
+    mov $8, %rax
+    push %rax
+   .loc 1 27
+    lea .L..main.23(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    mov $8, %rax
+    push %rax
+   .loc 1 28
+    mov $8, %rax
+    push %rax
+   .loc 1 28
+    lea .L..main.24(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 29
+   .loc 1 29
+   .loc 1 29
+    lea .L..main.25(%rip), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call printf
+   .loc 1 30
+   .loc 1 30
+    mov $0, %rax
+    jmp .L.return.main
+.L.return.main:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
@@ -51,6 +51,8 @@ int main()
 
     ASSERT(16, ({ struct {char a; long b;} x; sizeof(x); })); // align each member size to long
     ASSERT(4, ({ struct {char a; short b; }x; sizeof(x); }));
+    ASSERT(9, ({ struct {int a; int b; int c; int d; int e; int f; int g; int h; int i; int j;} x; x.a = 1; x.i = 8; x.j = 9; x.a + x.i; }));
+    ASSERT(24, ({ struct {char a; int b; long c; char d; int e; long f;} x; char* p = &x.f; p - &x.a; }));
     printf("OK\n");
     return 0;
 }
\ No newline at end of file
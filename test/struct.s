@@ -0,0 +1,4217 @@
+.file 1 "test/struct.c"
+.file 2 "test/test.h"
+    .data
+    .global .L..main.42
+.L..main.42:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+    .data
+    .global .L..main.41
+.L..main.41:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 32
+    .byte 99
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 100
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 101
+    .byte 59
+    .byte 32
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 32
+    .byte 102
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 42
+    .byte 32
+    .byte 112
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 38
+    .byte 120
+    .byte 46
+    .byte 102
+    .byte 59
+    .byte 32
+    .byte 112
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 38
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.40
+.L..main.40:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 99
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 100
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 101
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 102
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 103
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 104
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 105
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 106
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 105
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 56
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 106
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 57
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 105
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.39
+.L..main.39:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 104
+    .byte 111
+    .byte 114
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.38
+.L..main.38:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.37
+.L..main.37:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 121
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.36
+.L..main.36:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 121
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.35
+.L..main.35:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 44
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 44
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.34
+.L..main.34:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 44
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 55
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 44
+    .byte 32
+    .byte 42
+    .byte 112
+    .byte 61
+    .byte 38
+    .byte 120
+    .byte 44
+    .byte 32
+    .byte 42
+    .byte 113
+    .byte 61
+    .byte 38
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 113
+    .byte 61
+    .byte 42
+    .byte 112
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.33
+.L..main.33:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 44
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 55
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 122
+    .byte 61
+    .byte 38
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 122
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.32
+.L..main.32:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 44
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 44
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.31
+.L..main.31:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 44
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 44
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.30
+.L..main.30:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 44
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 55
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 44
+    .byte 32
+    .byte 42
+    .byte 112
+    .byte 61
+    .byte 38
+    .byte 120
+    .byte 44
+    .byte 32
+    .byte 42
+    .byte 113
+    .byte 61
+    .byte 38
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 113
+    .byte 61
+    .byte 42
+    .byte 112
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.29
+.L..main.29:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 44
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 55
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 122
+    .byte 61
+    .byte 38
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 42
+    .byte 122
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.28
+.L..main.28:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 44
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 44
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.27
+.L..main.27:
+    .byte 40
+    .byte 123
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 38
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 45
+    .byte 62
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.26
+.L..main.26:
+    .byte 40
+    .byte 123
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 42
+    .byte 121
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 38
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 45
+    .byte 62
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.25
+.L..main.25:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 125
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 120
+    .byte 61
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 116
+    .byte 43
+    .byte 121
+    .byte 46
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.24
+.L..main.24:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 59
+    .byte 125
+    .byte 59
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 125
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 121
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.23
+.L..main.23:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 121
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.22
+.L..main.22:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 121
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.21
+.L..main.21:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.20
+.L..main.20:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.19
+.L..main.19:
+    .byte 40
+    .byte 123
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 125
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.18
+.L..main.18:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.17
+.L..main.17:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.16
+.L..main.16:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.15
+.L..main.15:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.14
+.L..main.14:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 44
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.13
+.L..main.13:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.12
+.L..main.12:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.11
+.L..main.11:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 46
+    .byte 98
+    .byte 61
+    .byte 54
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 46
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.10
+.L..main.10:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 91
+    .byte 53
+    .byte 93
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 42
+    .byte 112
+    .byte 61
+    .byte 38
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 61
+    .byte 55
+    .byte 59
+    .byte 32
+    .byte 112
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.9
+.L..main.9:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 91
+    .byte 53
+    .byte 93
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 42
+    .byte 112
+    .byte 61
+    .byte 38
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 61
+    .byte 54
+    .byte 59
+    .byte 32
+    .byte 112
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.8
+.L..main.8:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 42
+    .byte 112
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 112
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 46
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.7
+.L..main.7:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 42
+    .byte 112
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 112
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 61
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.6
+.L..main.6:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 42
+    .byte 112
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 112
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 61
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 46
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.5
+.L..main.5:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 42
+    .byte 112
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 112
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 61
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.4
+.L..main.4:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 99
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 61
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 99
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 99
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.3
+.L..main.3:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 99
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 61
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 61
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 99
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.2
+.L..main.2:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 99
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 61
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 99
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.1
+.L..main.1:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 61
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.0
+.L..main.0:
+    .byte 40
+    .byte 123
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .global main
+    .text
+main:
+    push %rbp
+    mov %rsp, %rbp
+    sub $608, %rsp
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    mov $1, %rax
+    push %rax
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    lea -596(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 5
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 5
+   .loc 1 5
+    lea -596(%rbp), %rax
+  add $4, %rax
+    push %rax
+   .loc 1 5
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 5
+   .loc 1 5
+    lea -596(%rbp), %rax
+  add $0, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 5
+    lea .L..main.0(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    mov $2, %rax
+    push %rax
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    lea -588(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 6
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 6
+   .loc 1 6
+    lea -588(%rbp), %rax
+  add $4, %rax
+    push %rax
+   .loc 1 6
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 6
+   .loc 1 6
+    lea -588(%rbp), %rax
+  add $4, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 6
+    lea .L..main.1(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    mov $1, %rax
+    push %rax
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    lea -580(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 7
+    mov $1, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 7
+   .loc 1 7
+    lea -580(%rbp), %rax
+  add $4, %rax
+    push %rax
+   .loc 1 7
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 7
+   .loc 1 7
+    lea -580(%rbp), %rax
+  add $8, %rax
+    push %rax
+   .loc 1 7
+    mov $3, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 7
+   .loc 1 7
+    lea -580(%rbp), %rax
+  add $0, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 7
+    lea .L..main.2(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    mov $2, %rax
+    push %rax
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    lea -568(%rbp), %rax
+  add $4, %rax
+    push %rax
+   .loc 1 8
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 8
+   .loc 1 8
+    lea -568(%rbp), %rax
+  add $4, %rax
+    push %rax
+   .loc 1 8
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 8
+   .loc 1 8
+    lea -568(%rbp), %rax
+  add $8, %rax
+    push %rax
+   .loc 1 8
+    mov $3, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 8
+   .loc 1 8
+    lea -568(%rbp), %rax
+  add $4, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 8
+    lea .L..main.3(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    mov $3, %rax
+    push %rax
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    lea -556(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 9
+    mov $1, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 9
+   .loc 1 9
+    lea -556(%rbp), %rax
+  add $4, %rax
+    push %rax
+   .loc 1 9
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 9
+   .loc 1 9
+    lea -556(%rbp), %rax
+  add $8, %rax
+    push %rax
+   .loc 1 9
+    mov $3, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 9
+   .loc 1 9
+    lea -556(%rbp), %rax
+  add $8, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 9
+    lea .L..main.4(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    mov $0, %rax
+    push %rax
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    lea -536(%rbp), %rax
+    push %rax
+   .loc 1 11
+   .loc 1 11
+    lea -542(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    lea -536(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 11
+    mov $0, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    lea -542(%rbp), %rax
+  add $0, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 11
+    lea .L..main.5(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    mov $1, %rax
+    push %rax
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea -520(%rbp), %rax
+    push %rax
+   .loc 1 12
+   .loc 1 12
+    lea -526(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    mov $1, %rax
+    push %rax
+   .loc 1 12
+    lea -520(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 12
+    mov $1, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea -526(%rbp), %rax
+  add $1, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 12
+    lea .L..main.6(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    mov $2, %rax
+    push %rax
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    lea -504(%rbp), %rax
+    push %rax
+   .loc 1 13
+   .loc 1 13
+    lea -510(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    mov $2, %rax
+    push %rax
+   .loc 1 13
+    lea -504(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 13
+    mov $2, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    mov $2, %rax
+    push %rax
+   .loc 1 13
+   .loc 1 13
+    lea -510(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+  add $0, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 13
+    lea .L..main.7(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    mov $3, %rax
+    push %rax
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    lea -488(%rbp), %rax
+    push %rax
+   .loc 1 14
+   .loc 1 14
+    lea -494(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    mov $3, %rax
+    push %rax
+   .loc 1 14
+    lea -488(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 14
+    mov $3, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    mov $2, %rax
+    push %rax
+   .loc 1 14
+   .loc 1 14
+    lea -494(%rbp), %rax
+    pop %rdi
+    add %rdi, %rax
+  add $1, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 14
+    lea .L..main.8(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+    mov $6, %rax
+    push %rax
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+    lea -472(%rbp), %rax
+    push %rax
+   .loc 1 16
+   .loc 1 16
+    lea -480(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+    lea -480(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 16
+    mov $6, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+    lea -472(%rbp), %rax
+    mov (%rax), %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 16
+    lea .L..main.9(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    mov $7, %rax
+    push %rax
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    lea -456(%rbp), %rax
+    push %rax
+   .loc 1 17
+   .loc 1 17
+    lea -464(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    lea -464(%rbp), %rax
+  add $3, %rax
+    push %rax
+   .loc 1 17
+    mov $7, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    mov $3, %rax
+    push %rax
+   .loc 1 17
+    lea -456(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    add %rdi, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 17
+    lea .L..main.10(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+    mov $6, %rax
+    push %rax
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+    lea -445(%rbp), %rax
+  add $0, %rax
+  add $0, %rax
+    push %rax
+   .loc 1 19
+    mov $6, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 19
+   .loc 1 19
+    lea -445(%rbp), %rax
+  add $0, %rax
+  add $0, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 19
+    lea .L..main.11(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    mov $4, %rax
+    push %rax
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    mov $4, %rax
+    push %rax
+   .loc 1 21
+    lea .L..main.12(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 22
+   .loc 1 22
+   .loc 1 22
+    mov $8, %rax
+    push %rax
+   .loc 1 22
+   .loc 1 22
+   .loc 1 22
+   .loc 1 22
+    mov $8, %rax
+    push %rax
+   .loc 1 22
+    lea .L..main.13(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+    mov $8, %rax
+    push %rax
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+    mov $8, %rax
+    push %rax
+   .loc 1 23
+    lea .L..main.14(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+    mov $12, %rax
+    push %rax
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+    mov $12, %rax
+    push %rax
+   .loc 1 24
+    lea .L..main.15(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+    mov $16, %rax
+    push %rax
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+    mov $16, %rax
+    push %rax
+   .loc 1 25
+    lea .L..main.16(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    mov $24, %rax
+    push %rax
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    mov $24, %rax
+    push %rax
+   .loc 1 26
+    lea .L..main.17(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+    mov $2, %rax
+    push %rax
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+    mov $2, %rax
+    push %rax
+   .loc 1 27
+    lea .L..main.18(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    mov $0, %rax
+    push %rax
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    mov $0, %rax
+    push %rax
+   .loc 1 28
+    lea .L..main.19(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 29
+   .loc 1 29
+   .loc 1 29
+    mov $8, %rax
+    push %rax
+   .loc 1 29
+   .loc 1 29
+   .loc 1 29
+   .loc 1 29
+    mov $8, %rax
+    push %rax
+   .loc 1 29
+    lea .L..main.20(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+    mov $8, %rax
+    push %rax
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+    mov $8, %rax
+    push %rax
+   .loc 1 30
+    lea .L..main.21(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $8, %rax
+    push %rax
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $8, %rax
+    push %rax
+   .loc 1 32
+    lea .L..main.22(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $8, %rax
+    push %rax
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $8, %rax
+    push %rax
+   .loc 1 33
+    lea .L..main.23(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $2, %rax
+    push %rax
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $2, %rax
+    push %rax
+   .loc 1 34
+    lea .L..main.24(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+    mov $3, %rax
+    push %rax
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+    lea -324(%rbp), %rax
+    push %rax
+   .loc 1 35
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+    lea -320(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 35
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+    lea -320(%rbp), %rax
+  add $0, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 35
+    lea -324(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    push %rax
+   .loc 1 35
+    lea .L..main.25(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+    mov $3, %rax
+    push %rax
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+    lea -312(%rbp), %rax
+    push %rax
+   .loc 1 36
+   .loc 1 36
+    lea -313(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 36
+   .loc 1 36
+    lea -313(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 36
+    mov $3, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 36
+   .loc 1 36
+   .loc 1 36
+    lea -312(%rbp), %rax
+    mov (%rax), %rax
+  add $0, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 36
+    lea .L..main.26(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+    mov $3, %rax
+    push %rax
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+    lea -296(%rbp), %rax
+    push %rax
+   .loc 1 37
+   .loc 1 37
+    lea -297(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+    lea -296(%rbp), %rax
+    mov (%rax), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 37
+    mov $3, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 37
+   .loc 1 37
+    lea -297(%rbp), %rax
+  add $0, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 37
+    lea .L..main.27(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+    mov $3, %rax
+    push %rax
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+   .loc 1 39
+    lea -288(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 39
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 39
+   .loc 1 39
+    lea -280(%rbp), %rax
+    push %rax
+   .loc 1 39
+    lea -288(%rbp), %rax
+    pop %rdi
+   mov 0(%rax), %r8b
+   mov %r8b, 0(%rdi)
+   mov 1(%rax), %r8b
+   mov %r8b, 1(%rdi)
+   mov 2(%rax), %r8b
+   mov %r8b, 2(%rdi)
+   mov 3(%rax), %r8b
+   mov %r8b, 3(%rdi)
+   mov 4(%rax), %r8b
+   mov %r8b, 4(%rdi)
+   mov 5(%rax), %r8b
+   mov %r8b, 5(%rdi)
+   mov 6(%rax), %r8b
+   mov %r8b, 6(%rdi)
+   mov 7(%rax), %r8b
+   mov %r8b, 7(%rdi)
+   .loc 1 39
+   .loc 1 39
+    lea -280(%rbp), %rax
+  add $0, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 39
+    lea .L..main.28(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    mov $7, %rax
+    push %rax
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    lea -272(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 40
+    mov $7, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    lea -256(%rbp), %rax
+    push %rax
+   .loc 1 40
+   .loc 1 40
+    lea -264(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    lea -256(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 40
+    lea -272(%rbp), %rax
+    pop %rdi
+   mov 0(%rax), %r8b
+   mov %r8b, 0(%rdi)
+   mov 1(%rax), %r8b
+   mov %r8b, 1(%rdi)
+   mov 2(%rax), %r8b
+   mov %r8b, 2(%rdi)
+   mov 3(%rax), %r8b
+   mov %r8b, 3(%rdi)
+   mov 4(%rax), %r8b
+   mov %r8b, 4(%rdi)
+   mov 5(%rax), %r8b
+   mov %r8b, 5(%rdi)
+   mov 6(%rax), %r8b
+   mov %r8b, 6(%rdi)
+   mov 7(%rax), %r8b
+   mov %r8b, 7(%rdi)
+   .loc 1 40
+   .loc 1 40
+    lea -264(%rbp), %rax
+  add $0, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 40
+    lea .L..main.29(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    mov $7, %rax
+    push %rax
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    lea -248(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 41
+    mov $7, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    lea -232(%rbp), %rax
+    push %rax
+   .loc 1 41
+   .loc 1 41
+    lea -248(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 41
+   .loc 1 41
+    lea -224(%rbp), %rax
+    push %rax
+   .loc 1 41
+   .loc 1 41
+    lea -240(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    lea -224(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 41
+   .loc 1 41
+    lea -232(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+   mov 0(%rax), %r8b
+   mov %r8b, 0(%rdi)
+   mov 1(%rax), %r8b
+   mov %r8b, 1(%rdi)
+   mov 2(%rax), %r8b
+   mov %r8b, 2(%rdi)
+   mov 3(%rax), %r8b
+   mov %r8b, 3(%rdi)
+   mov 4(%rax), %r8b
+   mov %r8b, 4(%rdi)
+   mov 5(%rax), %r8b
+   mov %r8b, 5(%rdi)
+   mov 6(%rax), %r8b
+   mov %r8b, 6(%rdi)
+   mov 7(%rax), %r8b
+   mov %r8b, 7(%rdi)
+   .loc 1 41
+   .loc 1 41
+    lea -240(%rbp), %rax
+  add $0, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 41
+    lea .L..main.30(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 42
+   .loc 1 42
+   .loc 1 42
+    mov $5, %rax
+    push %rax
+   .loc 1 42
+   .loc 1 42
+   .loc 1 42
+   .loc 1 42
+    lea -212(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 42
+    mov $5, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 42
+   .loc 1 42
+    lea -210(%rbp), %rax
+    push %rax
+   .loc 1 42
+    lea -212(%rbp), %rax
+    pop %rdi
+   mov 0(%rax), %r8b
+   mov %r8b, 0(%rdi)
+   mov 1(%rax), %r8b
+   mov %r8b, 1(%rdi)
+   .loc 1 42
+   .loc 1 42
+    lea -210(%rbp), %rax
+  add $0, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 42
+    lea .L..main.31(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 44
+   .loc 1 44
+   .loc 1 44
+    mov $3, %rax
+    push %rax
+   .loc 1 44
+   .loc 1 44
+   .loc 1 44
+   .loc 1 44
+    lea -208(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 44
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 44
+   .loc 1 44
+    lea -200(%rbp), %rax
+    push %rax
+   .loc 1 44
+    lea -208(%rbp), %rax
+    pop %rdi
+   mov 0(%rax), %r8b
+   mov %r8b, 0(%rdi)
+   mov 1(%rax), %r8b
+   mov %r8b, 1(%rdi)
+   mov 2(%rax), %r8b
+   mov %r8b, 2(%rdi)
+   mov 3(%rax), %r8b
+   mov %r8b, 3(%rdi)
+   mov 4(%rax), %r8b
+   mov %r8b, 4(%rdi)
+   mov 5(%rax), %r8b
+   mov %r8b, 5(%rdi)
+   mov 6(%rax), %r8b
+   mov %r8b, 6(%rdi)
+   mov 7(%rax), %r8b
+   mov %r8b, 7(%rdi)
+   .loc 1 44
+   .loc 1 44
+    lea -200(%rbp), %rax
+  add $0, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 44
+    lea .L..main.32(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+    mov $7, %rax
+    push %rax
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+    lea -192(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 45
+    mov $7, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+    lea -176(%rbp), %rax
+    push %rax
+   .loc 1 45
+   .loc 1 45
+    lea -184(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+    lea -176(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 45
+    lea -192(%rbp), %rax
+    pop %rdi
+   mov 0(%rax), %r8b
+   mov %r8b, 0(%rdi)
+   mov 1(%rax), %r8b
+   mov %r8b, 1(%rdi)
+   mov 2(%rax), %r8b
+   mov %r8b, 2(%rdi)
+   mov 3(%rax), %r8b
+   mov %r8b, 3(%rdi)
+   mov 4(%rax), %r8b
+   mov %r8b, 4(%rdi)
+   mov 5(%rax), %r8b
+   mov %r8b, 5(%rdi)
+   mov 6(%rax), %r8b
+   mov %r8b, 6(%rdi)
+   mov 7(%rax), %r8b
+   mov %r8b, 7(%rdi)
+   .loc 1 45
+   .loc 1 45
+    lea -184(%rbp), %rax
+  add $0, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 45
+    lea .L..main.33(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 46
+   .loc 1 46
+   .loc 1 46
+    mov $7, %rax
+    push %rax
+   .loc 1 46
+   .loc 1 46
+   .loc 1 46
+   .loc 1 46
+   .loc 1 46
+    lea -168(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 46
+    mov $7, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 46
+   .loc 1 46
+   .loc 1 46
+    lea -152(%rbp), %rax
+    push %rax
+   .loc 1 46
+   .loc 1 46
+    lea -168(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 46
+   .loc 1 46
+    lea -144(%rbp), %rax
+    push %rax
+   .loc 1 46
+   .loc 1 46
+    lea -160(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 46
+   .loc 1 46
+   .loc 1 46
+    lea -144(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 46
+   .loc 1 46
+    lea -152(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+   mov 0(%rax), %r8b
+   mov %r8b, 0(%rdi)
+   mov 1(%rax), %r8b
+   mov %r8b, 1(%rdi)
+   mov 2(%rax), %r8b
+   mov %r8b, 2(%rdi)
+   mov 3(%rax), %r8b
+   mov %r8b, 3(%rdi)
+   mov 4(%rax), %r8b
+   mov %r8b, 4(%rdi)
+   mov 5(%rax), %r8b
+   mov %r8b, 5(%rdi)
+   mov 6(%rax), %r8b
+   mov %r8b, 6(%rdi)
+   mov 7(%rax), %r8b
+   mov %r8b, 7(%rdi)
+   .loc 1 46
+   .loc 1 46
+    lea -160(%rbp), %rax
+  add $0, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 46
+    lea .L..main.34(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 47
+   .loc 1 47
+   .loc 1 47
+    mov $5, %rax
+    push %rax
+   .loc 1 47
+   .loc 1 47
+   .loc 1 47
+   .loc 1 47
+    lea -132(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 47
+    mov $5, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 47
+   .loc 1 47
+    lea -130(%rbp), %rax
+    push %rax
+   .loc 1 47
+    lea -132(%rbp), %rax
+    pop %rdi
+   mov 0(%rax), %r8b
+   mov %r8b, 0(%rdi)
+   mov 1(%rax), %r8b
+   mov %r8b, 1(%rdi)
+   .loc 1 47
+   .loc 1 47
+    lea -130(%rbp), %rax
+  add $0, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 47
+    lea .L..main.35(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 49
+   .loc 1 49
+   .loc 1 49
+    mov $8, %rax
+    push %rax
+   .loc 1 49
+   .loc 1 49
+   .loc 1 49
+   .loc 1 49
+   .loc 1 49
+    mov $8, %rax
+    push %rax
+   .loc 1 49
+    lea .L..main.36(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 50
+   .loc 1 50
+   .loc 1 50
+    mov $8, %rax
+    push %rax
+   .loc 1 50
+   .loc 1 50
+   .loc 1 50
+   .loc 1 50
+   .loc 1 50
+    mov $8, %rax
+    push %rax
+   .loc 1 50
+    lea .L..main.37(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 52
+   .loc 1 52
+   .loc 1 52
+    mov $16, %rax
+    push %rax
+   .loc 1 52
+   .loc 1 52
+   .loc 1 52
+   .loc 1 52
+    mov $16, %rax
+    push %rax
+   .loc 1 52
+    lea .L..main.38(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+    mov $4, %rax
+    push %rax
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+    mov $4, %rax
+    push %rax
+   .loc 1 53
+    lea .L..main.39(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 54
+   .loc 1 54
+   .loc 1 54
+    mov $9, %rax
+    push %rax
+   .loc 1 54
+   .loc 1 54
+   .loc 1 54
+   .loc 1 54
+    lea -80(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 54
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 54
+   .loc 1 54
+    lea -80(%rbp), %rax
+  add $32, %rax
+    push %rax
+   .loc 1 54
+    mov $8, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 54
+   .loc 1 54
+    lea -80(%rbp), %rax
+  add $36, %rax
+    push %rax
+   .loc 1 54
+    mov $9, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 54
+   .loc 1 54
+   .loc 1 54
+    lea -80(%rbp), %rax
+  add $32, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 54
+    lea -80(%rbp), %rax
+  add $0, %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    push %rax
+   .loc 1 54
+    lea .L..main.40(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 55
+   .loc 1 55
+   .loc 1 55
+    mov $24, %rax
+    push %rax
+   .loc 1 55
+   .loc 1 55
+   .loc 1 55
+   .loc 1 55
+   .loc 1 55
+    lea -8(%rbp), %rax
+    push %rax
+   .loc 1 55
+   .loc 1 55
+    lea -40(%rbp), %rax
+  add $24, %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 55
+   .loc 1 55
+   .loc 1 55
+    lea -40(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 55
+    lea -8(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    sub %rdi, %rax
+    push %rax
+   .loc 1 55
+    lea .L..main.41(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 56
+   .loc 1 56
+   .loc 1 56
+    lea .L..main.42(%rip), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call printf
+   .loc 1 57
+   .loc 1 57
+    mov $0, %rax
+    jmp .L.return.main
+.L.return.main:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
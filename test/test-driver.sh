@@ -26,4 +26,206 @@ check -o
 ./au_cc --help 2>&1 | grep -q au_cc
 check --help
 
+# --lex-threads: chunks split inside block comments must lex as a single pass does
+for i in $(seq 200); do echo "/* $i"; echo " */ int f$i(int x) { return x + $i; } // $i"; done > $tmp/chunks.c
+echo 'int main() { return f7(1); }' >> $tmp/chunks.c
+./au_cc --lex-threads=1 -o $tmp/serial.s $tmp/chunks.c &&
+    ./au_cc --lex-threads=7 -o $tmp/parallel.s $tmp/chunks.c &&
+    cmp -s $tmp/serial.s $tmp/parallel.s
+check --lex-threads
+
+# AU_CC_SCAN: every scanning kernel lexes as the scalar one does
+AU_CC_SCAN=scalar ./au_cc -o $tmp/scalar.s $tmp/chunks.c &&
+    AU_CC_SCAN=sse2 ./au_cc -o $tmp/sse2.s $tmp/chunks.c && cmp -s $tmp/scalar.s $tmp/sse2.s &&
+    AU_CC_SCAN=avx2 ./au_cc -o $tmp/avx2.s $tmp/chunks.c && cmp -s $tmp/scalar.s $tmp/avx2.s
+check AU_CC_SCAN
+
+# preprocessor: conditionals spanning declarations of a streamed input
+printf '#if 0\nint x;\nint y;\n#else\nint main() { return 0; }\n#endif\n' | ./au_cc -o $tmp/out - &&
+    grep -q main $tmp/out && ! grep -q 'x:' $tmp/out
+check 'preprocessor stdin'
+
+# -I: #include <...> searches the given directories
+mkdir -p $tmp/inc
+echo 'int inc() { return 1; }' > $tmp/inc/inc.h
+echo '#include <inc.h>' > $tmp/inc.c
+./au_cc -I $tmp/inc -o $tmp/out $tmp/inc.c && grep -q inc $tmp/out
+check -I
+
+echo '#if 1' > $tmp/cond.c
+./au_cc -o $tmp/out $tmp/cond.c 2>&1 | grep -q 'unterminated conditional directive'
+check 'unterminated #if'
+
+echo 'unsigned long x = 18446744073709551616;' > $tmp/overflow.c
+./au_cc -o $tmp/out $tmp/overflow.c 2>&1 | grep -q 'integer literal is too large'
+check 'integer literal overflow'
+
+# -j: each input of a batch is compiled to its own output, and messages are
+# reported in the order of the inputs
+mkdir -p $tmp/batch
+for i in 1 2 3 4 5 6; do echo "int f$i() { return $i; }" > $tmp/batch/ok$i.c; done
+echo 'int g() { return x; }' > $tmp/batch/bad1.c
+echo 'int h() { return y; }' > $tmp/batch/bad2.c
+! ./au_cc -j 4 $tmp/batch/bad2.c $tmp/batch/ok*.c $tmp/batch/bad1.c 2> $tmp/batch/err &&
+    grep -q f1: $tmp/batch/ok1.s && grep -q f6: $tmp/batch/ok6.s && [ ! -e $tmp/batch/bad1.s ] &&
+    [ "$(grep -o 'bad[12]\.c' $tmp/batch/err | uniq | tr '\n' ' ')" = 'bad2.c bad1.c ' ]
+check -j
+
+./au_cc -o $tmp/out $tmp/batch/ok1.c $tmp/batch/ok2.c 2>&1 | grep -q 'cannot specify -o'
+check '-o with multiple files'
+
+# --server: compiles the requests of --connect clients as au_cc itself would
+./au_cc --server=$tmp/sock &
+server=$!
+for i in $(seq 50); do [ -S $tmp/sock ] && break; sleep 0.1; done
+./au_cc -I $tmp/inc -o $tmp/local.s $tmp/inc.c &&
+    ./au_cc --connect=$tmp/sock -I $tmp/inc -o $tmp/remote.s $tmp/inc.c && cmp -s $tmp/local.s $tmp/remote.s &&
+    AU_CC_SERVER=$tmp/sock ./au_cc $tmp/batch/bad1.c 2>&1 | grep -q 'undefined variable' &&
+    echo 'int main() { return 0; }' | ./au_cc --connect=$tmp/sock - | grep -q main &&
+    (cd $tmp && $OLDPWD/au_cc -I inc -o local.s inc.c && $OLDPWD/au_cc --connect=$tmp/sock -I inc -o remote.s inc.c) &&
+    cmp -s $tmp/local.s $tmp/remote.s &&
+    mkdir -p $tmp/remote && cp $tmp/batch/ok*.c $tmp/remote &&
+    AU_CC_SERVER=$tmp/sock ./au_cc -j 6 $tmp/remote/ok*.c &&
+    [ $(grep -l 'f[1-6]:' $tmp/remote/ok*.s | wc -l) -eq 6 ]
+status=$?
+kill $server
+[ $status -eq 0 ]
+check --server
+
+# --cache-dir: a hit gives the same output; a change to an included file is a miss
+./au_cc --cache-dir=$tmp/cache -I $tmp/inc -o $tmp/cached1.s $tmp/inc.c &&
+    ./au_cc --cache-dir=$tmp/cache -I $tmp/inc -o $tmp/cached2.s $tmp/inc.c && cmp -s $tmp/cached1.s $tmp/cached2.s &&
+    echo 'int inc2() { return 2; }' >> $tmp/inc/inc.h &&
+    ./au_cc --cache-dir=$tmp/cache -I $tmp/inc -o $tmp/cached3.s $tmp/inc.c && grep -q inc2 $tmp/cached3.s &&
+    ./au_cc --cache-dir=$tmp/cache --cache-stats | tr '\n' ' ' | grep -q 'hits 1 misses 2'
+check --cache-dir
+
+# a header created where an #include searched before finding its file shadows
+# the cached one; an entry replaced on a miss is not counted twice
+mkdir -p $tmp/shadow/inc
+echo 'int shadowed() { return 1; }' > $tmp/shadow/inc/s.h
+echo '#include "s.h"' > $tmp/shadow/s.c
+./au_cc --cache-dir=$tmp/cache2 -I $tmp/shadow/inc -o $tmp/out $tmp/shadow/s.c &&
+    echo 'int shadowing() { return 2; }' > $tmp/shadow/s.h &&
+    ./au_cc --cache-dir=$tmp/cache2 -I $tmp/shadow/inc -o $tmp/out $tmp/shadow/s.c && grep -q shadowing $tmp/out &&
+    ./au_cc --cache-dir=$tmp/cache2 --cache-stats | grep -q "size $(find $tmp/cache2 -mindepth 2 -type f -printf '%s\n' | awk '{ n += $1 } END { print n }')$"
+check 'cache missing deps'
+
+./au_cc --cache-dir=$tmp/cache --cache-size=1 -o $tmp/out $tmp/batch/ok1.c &&
+    ./au_cc --cache-dir=$tmp/cache --cache-stats | grep -q 'size 0'
+check --cache-size
+
+# static functions: bodies are parsed only if referenced, and not exported
+echo 'static int f() { return 1; } static int g() { return 2; } int main() { return g(); }' > $tmp/static.c
+./au_cc -o $tmp/out $tmp/static.c && ! grep -q 'f:' $tmp/out && grep -q 'g:' $tmp/out && ! grep -q 'global g' $tmp/out
+check 'static functions'
+
+# a deferred body sees only the declarations before its definition
+echo 'static int helper() { return later; } int later = 5; int main() { return helper(); }' > $tmp/later.c
+./au_cc -o $tmp/out $tmp/later.c 2>&1 | grep -q 'undefined variable'
+check 'static function scope'
+
+# --incremental: reused functions give the output of a full compilation, also
+# after an edit moves the lines of those that follow it
+printf 'int f() {\n return 1;\n}\nstatic int g() { return 2; }\nint main() {\n return g() + f();\n}\n' > $tmp/incr.c
+./au_cc --incremental -o $tmp/incr.s $tmp/incr.c && [ -f $tmp/incr.s.fns ] &&
+    ./au_cc --incremental -o $tmp/incr.s $tmp/incr.c && ./au_cc -o $tmp/full.s $tmp/incr.c && cmp -s $tmp/incr.s $tmp/full.s &&
+    sed -i 's/return 1;/char* s = "x";\n return *s;/' $tmp/incr.c &&
+    ./au_cc --incremental -o $tmp/incr.s $tmp/incr.c && ./au_cc -o $tmp/full.s $tmp/incr.c && cmp -s $tmp/incr.s $tmp/full.s
+check --incremental
+
+AU_CC_SERVER=$tmp/sock ./au_cc --incremental -o $tmp/incr.s $tmp/incr.c 2>&1 | grep -q 'cannot be used with a compile server'
+check '--incremental with a server'
+
+# nesting far deeper than the native stack would allow
+awk 'BEGIN {
+    print "int main() {";
+    for (i = 0; i < 100000; i++) print "{";
+    for (i = 0; i < 100000; i++) print "}";
+    print "return";
+    for (i = 0; i < 1000000; i++) print "(";
+    for (i = 0; i < 100000; i++) print "({";
+    print "- - 7;";
+    for (i = 0; i < 100000; i++) print i ? "; })" : "})";
+    for (i = 0; i < 1000000; i++) print ")";
+    print "; }";
+}' > $tmp/deep.c
+./au_cc -o $tmp/deep.s $tmp/deep.c && gcc -o $tmp/deep $tmp/deep.s && $tmp/deep
+[ $? -eq 7 ]
+check 'deep nesting'
+
+# library: errors are returned, compilers on several threads are independent,
+# and a compiler releases what each unit allocated
+cat > $tmp/embed.c <<'END'
+#include "libau_cc.h"
+#include <malloc.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+static char* good = "int sq(int x) { return x * x; } int main() { return sq(3); }";
+static char* bad = "int main() { return x; }";
+
+static void* run(void* arg)
+{
+    Compiler* c = new_compiler();
+    void* res = NULL;
+    for (int i = 0; i < 50 && !res; ++i)
+    {
+        char* out;
+        size_t len;
+        if (compile_source(c, "bad.c", bad, strlen(bad), &out, &len) != -1 ||
+            !strstr(compiler_error(c), "undefined variable"))
+            res = "error not returned";
+        else if (compile_source(c, "good.c", good, strlen(good), &out, &len) != 0 ||
+                 !strstr(out, "sq:"))
+            res = "not compiled after an error";
+        else
+            free(out);
+    }
+    free_compiler(c);
+    return res;
+}
+
+static char* macros = "#define S(x) #x\n#define P(a, b) a##b\nchar* s = S(1 + 2); int P(x, 1) = __LINE__;\n";
+static char* missing = "#include \"missing.h\"\n";
+
+static int leaks(void)
+{
+    Compiler* c = new_compiler();
+    compiler_add_include_path(c, "/nonexistent");
+    size_t before = 0;
+    for (int i = 0; i < 2000; ++i)
+    {
+        if (i == 100)
+            before = mallinfo2().uordblks;
+        char* out;
+        size_t len;
+        if (compile_source(c, "macros.c", macros, strlen(macros), &out, &len) == 0)
+            free(out);
+        compile_source(c, "missing.c", missing, strlen(missing), &out, &len);
+    }
+    size_t after = mallinfo2().uordblks;
+    free_compiler(c);
+    return after > before + 64 * 1024;
+}
+
+int main()
+{
+    pthread_t threads[4];
+    for (int i = 0; i < 4; ++i)
+        pthread_create(&threads[i], NULL, run, NULL);
+    int failed = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+        void* res;
+        pthread_join(threads[i], &res);
+        failed |= res != NULL;
+    }
+    return failed || leaks();
+}
+END
+gcc -I. -pthread -o $tmp/embed $tmp/embed.c libau_cc.a && $tmp/embed
+check library
+
 echo GOOD JOB!
\ No newline at end of file
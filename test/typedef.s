@@ -0,0 +1,511 @@
+.file 1 "test/typedef.c"
+.file 2 "test/test.h"
+    .data
+    .global .L..main.7
+.L..main.7:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+    .data
+    .global .L..main.6
+.L..main.6:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 77
+    .byte 121
+    .byte 73
+    .byte 110
+    .byte 116
+    .byte 50
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.5
+.L..main.5:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 77
+    .byte 121
+    .byte 73
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.4
+.L..main.4:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 116
+    .byte 121
+    .byte 112
+    .byte 101
+    .byte 100
+    .byte 101
+    .byte 102
+    .byte 32
+    .byte 116
+    .byte 59
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.3
+.L..main.3:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 116
+    .byte 121
+    .byte 112
+    .byte 101
+    .byte 100
+    .byte 101
+    .byte 102
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 116
+    .byte 59
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 116
+    .byte 121
+    .byte 112
+    .byte 101
+    .byte 100
+    .byte 101
+    .byte 102
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.2
+.L..main.2:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 116
+    .byte 121
+    .byte 112
+    .byte 101
+    .byte 100
+    .byte 101
+    .byte 102
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 59
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 116
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.1
+.L..main.1:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 116
+    .byte 121
+    .byte 112
+    .byte 101
+    .byte 100
+    .byte 101
+    .byte 102
+    .byte 32
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 116
+    .byte 59
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.0
+.L..main.0:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 116
+    .byte 121
+    .byte 112
+    .byte 101
+    .byte 100
+    .byte 101
+    .byte 102
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 116
+    .byte 59
+    .byte 32
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .global main
+    .text
+main:
+    push %rbp
+    mov %rsp, %rbp
+    sub $48, %rsp
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    mov $1, %rax
+    push %rax
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    lea -40(%rbp), %rax
+    push %rax
+   .loc 1 8
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 8
+   .loc 1 8
+    lea -40(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 8
+    lea .L..main.0(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    mov $1, %rax
+    push %rax
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    lea -36(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 9
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 9
+   .loc 1 9
+    lea -36(%rbp), %rax
+  add $0, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 9
+    lea .L..main.1(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    mov $1, %rax
+    push %rax
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    lea -32(%rbp), %rax
+    push %rax
+   .loc 1 10
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 10
+   .loc 1 10
+    lea -32(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 10
+    lea .L..main.2(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    mov $2, %rax
+    push %rax
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    lea -28(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 11
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 11
+   .loc 1 11
+    lea -28(%rbp), %rax
+  add $0, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 11
+    lea .L..main.3(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    mov $4, %rax
+    push %rax
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    mov $4, %rax
+    push %rax
+   .loc 1 12
+    lea .L..main.4(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    mov $3, %rax
+    push %rax
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    lea -20(%rbp), %rax
+    push %rax
+   .loc 1 13
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 13
+   .loc 1 13
+    lea -20(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 13
+    lea .L..main.5(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    mov $16, %rax
+    push %rax
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    mov $16, %rax
+    push %rax
+   .loc 1 14
+    lea .L..main.6(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 16
+   .loc 1 16
+   .loc 1 16
+    lea .L..main.7(%rip), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call printf
+   .loc 1 17
+   .loc 1 17
+    mov $0, %rax
+    jmp .L.return.main
+.L.return.main:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
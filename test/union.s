@@ -0,0 +1,730 @@
+.file 1 "test/union.c"
+.file 2 "test/test.h"
+    .data
+    .global .L..main.7
+.L..main.7:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+    .data
+    .global .L..main.6
+.L..main.6:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 117
+    .byte 110
+    .byte 105
+    .byte 111
+    .byte 110
+    .byte 32
+    .byte 123
+    .byte 115
+    .byte 116
+    .byte 114
+    .byte 117
+    .byte 99
+    .byte 116
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 44
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 99
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 44
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 99
+    .byte 46
+    .byte 98
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 99
+    .byte 46
+    .byte 98
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 99
+    .byte 46
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.5
+.L..main.5:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 117
+    .byte 110
+    .byte 105
+    .byte 111
+    .byte 110
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 44
+    .byte 98
+    .byte 59
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 44
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 97
+    .byte 61
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 61
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 46
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.4
+.L..main.4:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 117
+    .byte 110
+    .byte 105
+    .byte 111
+    .byte 110
+    .byte 32
+    .byte 123
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 125
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 53
+    .byte 49
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.3
+.L..main.3:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 117
+    .byte 110
+    .byte 105
+    .byte 111
+    .byte 110
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 53
+    .byte 49
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.2
+.L..main.2:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 117
+    .byte 110
+    .byte 105
+    .byte 111
+    .byte 110
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 53
+    .byte 49
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.1
+.L..main.1:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 117
+    .byte 110
+    .byte 105
+    .byte 111
+    .byte 110
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 53
+    .byte 49
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 46
+    .byte 98
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.0
+.L..main.0:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 117
+    .byte 110
+    .byte 105
+    .byte 111
+    .byte 110
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 98
+    .byte 91
+    .byte 54
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .global main
+    .text
+main:
+    push %rbp
+    mov %rsp, %rbp
+    sub $48, %rsp
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    mov $8, %rax
+    push %rax
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+   .loc 1 5
+    mov $8, %rax
+    push %rax
+   .loc 1 5
+    lea .L..main.0(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    mov $3, %rax
+    push %rax
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    lea -40(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 6
+    mov $515, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+   .loc 1 6
+    lea -40(%rbp), %rax
+  add $0, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 6
+    lea .L..main.1(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    mov $2, %rax
+    push %rax
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    lea -36(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 7
+    mov $515, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    mov $1, %rax
+    push %rax
+   .loc 1 7
+   .loc 1 7
+    lea -36(%rbp), %rax
+  add $0, %rax
+    pop %rdi
+    add %rdi, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 7
+    lea .L..main.2(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    mov $0, %rax
+    push %rax
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    lea -32(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 8
+    mov $515, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    mov $2, %rax
+    push %rax
+   .loc 1 8
+   .loc 1 8
+    lea -32(%rbp), %rax
+  add $0, %rax
+    pop %rdi
+    add %rdi, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 8
+    lea .L..main.3(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    mov $0, %rax
+    push %rax
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    lea -28(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 9
+    mov $515, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    mov $3, %rax
+    push %rax
+   .loc 1 9
+   .loc 1 9
+    lea -28(%rbp), %rax
+  add $0, %rax
+    pop %rdi
+    add %rdi, %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 9
+    lea .L..main.4(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    mov $3, %rax
+    push %rax
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+   .loc 1 10
+    lea -24(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 10
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 10
+   .loc 1 10
+    lea -20(%rbp), %rax
+  add $0, %rax
+    push %rax
+   .loc 1 10
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 10
+   .loc 1 10
+    lea -20(%rbp), %rax
+    push %rax
+   .loc 1 10
+   .loc 1 10
+    lea -24(%rbp), %rax
+    pop %rdi
+   mov 0(%rax), %r8b
+   mov %r8b, 0(%rdi)
+   mov 1(%rax), %r8b
+   mov %r8b, 1(%rdi)
+   mov 2(%rax), %r8b
+   mov %r8b, 2(%rdi)
+   mov 3(%rax), %r8b
+   mov %r8b, 3(%rdi)
+   .loc 1 10
+   .loc 1 10
+    lea -20(%rbp), %rax
+  add $0, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 10
+    lea .L..main.5(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    mov $3, %rax
+    push %rax
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    lea -16(%rbp), %rax
+  add $0, %rax
+  add $4, %rax
+    push %rax
+   .loc 1 11
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 11
+   .loc 1 11
+    lea -8(%rbp), %rax
+  add $0, %rax
+  add $4, %rax
+    push %rax
+   .loc 1 11
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 11
+   .loc 1 11
+    lea -8(%rbp), %rax
+    push %rax
+   .loc 1 11
+   .loc 1 11
+    lea -16(%rbp), %rax
+    pop %rdi
+   mov 0(%rax), %r8b
+   mov %r8b, 0(%rdi)
+   mov 1(%rax), %r8b
+   mov %r8b, 1(%rdi)
+   mov 2(%rax), %r8b
+   mov %r8b, 2(%rdi)
+   mov 3(%rax), %r8b
+   mov %r8b, 3(%rdi)
+   mov 4(%rax), %r8b
+   mov %r8b, 4(%rdi)
+   mov 5(%rax), %r8b
+   mov %r8b, 5(%rdi)
+   mov 6(%rax), %r8b
+   mov %r8b, 6(%rdi)
+   mov 7(%rax), %r8b
+   mov %r8b, 7(%rdi)
+   .loc 1 11
+   .loc 1 11
+    lea -8(%rbp), %rax
+  add $0, %rax
+  add $4, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 11
+    lea .L..main.6(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea .L..main.7(%rip), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call printf
+   .loc 1 13
+   .loc 1 13
+    mov $0, %rax
+    jmp .L.return.main
+.L.return.main:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
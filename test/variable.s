@@ -0,0 +1,3333 @@
+.file 1 "test/variable.c"
+.file 2 "test/test.h"
+    .data
+    .global g2
+g2:
+    .zero 16
+    .data
+    .global g1
+g1:
+    .zero 4
+    .data
+    .global .L..main.48
+.L..main.48:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+    .data
+    .global .L..main.47
+.L..main.47:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 40
+    .byte 42
+    .byte 121
+    .byte 41
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 52
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.46
+.L..main.46:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 42
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 38
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.45
+.L..main.45:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 40
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 41
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.44
+.L..main.44:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 40
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 41
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.43
+.L..main.43:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.42
+.L..main.42:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.41
+.L..main.41:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 40
+    .byte 42
+    .byte 120
+    .byte 41
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.40
+.L..main.40:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 42
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.39
+.L..main.39:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 115
+    .byte 104
+    .byte 111
+    .byte 114
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.38
+.L..main.38:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 108
+    .byte 111
+    .byte 110
+    .byte 103
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.37
+.L..main.37:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 122
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 42
+    .byte 32
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 38
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 42
+    .byte 32
+    .byte 98
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 38
+    .byte 122
+    .byte 59
+    .byte 32
+    .byte 98
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.36
+.L..main.36:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 122
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 42
+    .byte 32
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 38
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 42
+    .byte 32
+    .byte 98
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 38
+    .byte 122
+    .byte 59
+    .byte 32
+    .byte 98
+    .byte 32
+    .byte 45
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.35
+.L..main.35:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.34
+.L..main.34:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 121
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 52
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.33
+.L..main.33:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.32
+.L..main.32:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 49
+    .byte 48
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.31
+.L..main.31:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.30
+.L..main.30:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 121
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 121
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.29
+.L..main.29:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 121
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.28
+.L..main.28:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 99
+    .byte 104
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.27
+.L..main.27:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 103
+    .byte 50
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.26
+.L..main.26:
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 103
+    .byte 49
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.25
+.L..main.25:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.24
+.L..main.24:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.23
+.L..main.23:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.22
+.L..main.22:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 48
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 49
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 50
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 50
+    .byte 91
+    .byte 48
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.21
+.L..main.21:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 103
+    .byte 49
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 103
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.20
+.L..main.20:
+    .byte 103
+    .byte 49
+    .byte 0
+    .data
+    .global .L..main.19
+.L..main.19:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.18
+.L..main.18:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 50
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.17
+.L..main.17:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 42
+    .byte 42
+    .byte 120
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 49
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.16
+.L..main.16:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 42
+    .byte 42
+    .byte 32
+    .byte 120
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.15
+.L..main.15:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 42
+    .byte 42
+    .byte 120
+    .byte 41
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 49
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.14
+.L..main.14:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 42
+    .byte 42
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.13
+.L..main.13:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 42
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.12
+.L..main.12:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 51
+    .byte 93
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.11
+.L..main.11:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 91
+    .byte 52
+    .byte 93
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.10
+.L..main.10:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 42
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.9
+.L..main.9:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.8
+.L..main.8:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 120
+    .byte 59
+    .byte 32
+    .byte 115
+    .byte 105
+    .byte 122
+    .byte 101
+    .byte 111
+    .byte 102
+    .byte 40
+    .byte 120
+    .byte 41
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.7
+.L..main.7:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 102
+    .byte 111
+    .byte 111
+    .byte 49
+    .byte 50
+    .byte 51
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 97
+    .byte 114
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 102
+    .byte 111
+    .byte 111
+    .byte 49
+    .byte 50
+    .byte 51
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 98
+    .byte 97
+    .byte 114
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.6
+.L..main.6:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 102
+    .byte 111
+    .byte 111
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 102
+    .byte 111
+    .byte 111
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.5
+.L..main.5:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 98
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 97
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 98
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.4
+.L..main.4:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 122
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 97
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 122
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.3
+.L..main.3:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.2
+.L..main.2:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 122
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 53
+    .byte 59
+    .byte 32
+    .byte 97
+    .byte 32
+    .byte 43
+    .byte 32
+    .byte 122
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.1
+.L..main.1:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .data
+    .global .L..main.0
+.L..main.0:
+    .byte 40
+    .byte 123
+    .byte 32
+    .byte 105
+    .byte 110
+    .byte 116
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 97
+    .byte 32
+    .byte 61
+    .byte 32
+    .byte 51
+    .byte 59
+    .byte 32
+    .byte 97
+    .byte 59
+    .byte 32
+    .byte 125
+    .byte 41
+    .byte 0
+    .global main
+    .text
+main:
+    push %rbp
+    mov %rsp, %rbp
+    sub $608, %rsp
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    mov $3, %rax
+    push %rax
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+   .loc 1 7
+    lea -608(%rbp), %rax
+    push %rax
+   .loc 1 7
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 7
+   .loc 1 7
+    lea -608(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 7
+    lea .L..main.0(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    mov $3, %rax
+    push %rax
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+   .loc 1 8
+    lea -604(%rbp), %rax
+    push %rax
+   .loc 1 8
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 8
+   .loc 1 8
+    lea -604(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 8
+    lea .L..main.1(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    mov $8, %rax
+    push %rax
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    lea -600(%rbp), %rax
+    push %rax
+   .loc 1 9
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    lea -596(%rbp), %rax
+    push %rax
+   .loc 1 9
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 9
+   .loc 1 9
+   .loc 1 9
+    lea -596(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 9
+    lea -600(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    push %rax
+   .loc 1 9
+    lea .L..main.2(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    mov $3, %rax
+    push %rax
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+   .loc 1 11
+    lea -592(%rbp), %rax
+    push %rax
+   .loc 1 11
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 11
+   .loc 1 11
+    lea -592(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 11
+    lea .L..main.3(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    mov $8, %rax
+    push %rax
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea -588(%rbp), %rax
+    push %rax
+   .loc 1 12
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea -584(%rbp), %rax
+    push %rax
+   .loc 1 12
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 12
+   .loc 1 12
+   .loc 1 12
+    lea -584(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 12
+    lea -588(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    push %rax
+   .loc 1 12
+    lea .L..main.4(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    mov $6, %rax
+    push %rax
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    lea -580(%rbp), %rax
+    push %rax
+   .loc 1 13
+   .loc 1 13
+    lea -576(%rbp), %rax
+    push %rax
+   .loc 1 13
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 13
+   .loc 1 13
+   .loc 1 13
+    lea -576(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 13
+    lea -580(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    push %rax
+   .loc 1 13
+    lea .L..main.5(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    mov $3, %rax
+    push %rax
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+   .loc 1 14
+    lea -572(%rbp), %rax
+    push %rax
+   .loc 1 14
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 14
+   .loc 1 14
+    lea -572(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 14
+    lea .L..main.6(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+    mov $8, %rax
+    push %rax
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+    lea -568(%rbp), %rax
+    push %rax
+   .loc 1 15
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+    lea -564(%rbp), %rax
+    push %rax
+   .loc 1 15
+    mov $5, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 15
+   .loc 1 15
+   .loc 1 15
+    lea -564(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 15
+    lea -568(%rbp), %rax
+   movsxd (%rax), %rax
+    pop %rdi
+    add %edi, %eax
+    push %rax
+   .loc 1 15
+    lea .L..main.7(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    mov $4, %rax
+    push %rax
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+   .loc 1 17
+    mov $4, %rax
+    push %rax
+   .loc 1 17
+    lea .L..main.8(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 18
+   .loc 1 18
+   .loc 1 18
+    mov $4, %rax
+    push %rax
+   .loc 1 18
+   .loc 1 18
+   .loc 1 18
+   .loc 1 18
+    mov $4, %rax
+    push %rax
+   .loc 1 18
+    lea .L..main.9(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+    mov $8, %rax
+    push %rax
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+   .loc 1 19
+    mov $8, %rax
+    push %rax
+   .loc 1 19
+    lea .L..main.10(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+    mov $16, %rax
+    push %rax
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+   .loc 1 20
+    mov $16, %rax
+    push %rax
+   .loc 1 20
+    lea .L..main.11(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    mov $48, %rax
+    push %rax
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+   .loc 1 21
+    mov $48, %rax
+    push %rax
+   .loc 1 21
+    lea .L..main.12(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 22
+   .loc 1 22
+   .loc 1 22
+    mov $16, %rax
+    push %rax
+   .loc 1 22
+   .loc 1 22
+   .loc 1 22
+   .loc 1 22
+    mov $16, %rax
+    push %rax
+   .loc 1 22
+    lea .L..main.13(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+    mov $4, %rax
+    push %rax
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+   .loc 1 23
+    mov $4, %rax
+    push %rax
+   .loc 1 23
+    lea .L..main.14(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+    mov $5, %rax
+    push %rax
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+   .loc 1 24
+    mov $5, %rax
+    push %rax
+   .loc 1 24
+    lea .L..main.15(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+    mov $5, %rax
+    push %rax
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+   .loc 1 25
+    mov $5, %rax
+    push %rax
+   .loc 1 25
+    lea .L..main.16(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    mov $4, %rax
+    push %rax
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+   .loc 1 26
+    mov $4, %rax
+    push %rax
+   .loc 1 26
+    lea .L..main.17(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+    mov $4, %rax
+    push %rax
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+   .loc 1 27
+    lea -236(%rbp), %rax
+    push %rax
+   .loc 1 27
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 27
+   .loc 1 27
+    mov $4, %rax
+    push %rax
+   .loc 1 27
+    lea .L..main.18(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    mov $1, %rax
+    push %rax
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+   .loc 1 28
+    lea -232(%rbp), %rax
+    push %rax
+   .loc 1 28
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 28
+   .loc 1 28
+    mov $4, %rax
+   .loc 1 28
+   .loc 1 28
+    lea -232(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 28
+    lea .L..main.19(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 30
+   .loc 1 30
+   .loc 1 30
+    mov $0, %rax
+    push %rax
+   .loc 1 30
+    lea g1(%rip), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 30
+    lea .L..main.20(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+    mov $3, %rax
+    push %rax
+   .loc 1 31
+   .loc 1 31
+   .loc 1 31
+    lea g1(%rip), %rax
+    push %rax
+   .loc 1 31
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 31
+   .loc 1 31
+    lea g1(%rip), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 31
+    lea .L..main.21(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $0, %rax
+    push %rax
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    lea g2(%rip), %rax
+    push %rax
+   .loc 1 32
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $4, %rax
+    push %rax
+   .loc 1 32
+   .loc 1 32
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 32
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $8, %rax
+    push %rax
+   .loc 1 32
+   .loc 1 32
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 32
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    mov $12, %rax
+    push %rax
+   .loc 1 32
+   .loc 1 32
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 32
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+   .loc 1 32
+    lea g2(%rip), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 32
+    lea .L..main.22(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $1, %rax
+    push %rax
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    lea g2(%rip), %rax
+    push %rax
+   .loc 1 33
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $4, %rax
+    push %rax
+   .loc 1 33
+   .loc 1 33
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 33
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $8, %rax
+    push %rax
+   .loc 1 33
+   .loc 1 33
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 33
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $12, %rax
+    push %rax
+   .loc 1 33
+   .loc 1 33
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 33
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+   .loc 1 33
+    mov $4, %rax
+    push %rax
+   .loc 1 33
+   .loc 1 33
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 33
+    lea .L..main.23(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $2, %rax
+    push %rax
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    lea g2(%rip), %rax
+    push %rax
+   .loc 1 34
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $4, %rax
+    push %rax
+   .loc 1 34
+   .loc 1 34
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 34
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $8, %rax
+    push %rax
+   .loc 1 34
+   .loc 1 34
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 34
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $12, %rax
+    push %rax
+   .loc 1 34
+   .loc 1 34
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 34
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+   .loc 1 34
+    mov $8, %rax
+    push %rax
+   .loc 1 34
+   .loc 1 34
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 34
+    lea .L..main.24(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+    mov $3, %rax
+    push %rax
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+    lea g2(%rip), %rax
+    push %rax
+   .loc 1 35
+    mov $0, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+    mov $4, %rax
+    push %rax
+   .loc 1 35
+   .loc 1 35
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 35
+    mov $1, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+    mov $8, %rax
+    push %rax
+   .loc 1 35
+   .loc 1 35
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 35
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+    mov $12, %rax
+    push %rax
+   .loc 1 35
+   .loc 1 35
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+    push %rax
+   .loc 1 35
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+   .loc 1 35
+    mov $12, %rax
+    push %rax
+   .loc 1 35
+   .loc 1 35
+    lea g2(%rip), %rax
+    pop %rdi
+    add %rdi, %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 35
+    lea .L..main.25(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 37
+   .loc 1 37
+   .loc 1 37
+    mov $4, %rax
+    push %rax
+   .loc 1 37
+    mov $4, %rax
+    push %rax
+   .loc 1 37
+    lea .L..main.26(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 38
+   .loc 1 38
+   .loc 1 38
+    mov $16, %rax
+    push %rax
+   .loc 1 38
+    mov $16, %rax
+    push %rax
+   .loc 1 38
+    lea .L..main.27(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    mov $1, %rax
+    push %rax
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+   .loc 1 40
+    lea -228(%rbp), %rax
+    push %rax
+   .loc 1 40
+    mov $1, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 40
+   .loc 1 40
+    lea -228(%rbp), %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 40
+    lea .L..main.28(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    mov $1, %rax
+    push %rax
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    lea -227(%rbp), %rax
+    push %rax
+   .loc 1 41
+    mov $1, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 41
+   .loc 1 41
+   .loc 1 41
+    lea -226(%rbp), %rax
+    push %rax
+   .loc 1 41
+    mov $2, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 41
+   .loc 1 41
+    lea -227(%rbp), %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 41
+    lea .L..main.29(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 42
+   .loc 1 42
+   .loc 1 42
+    mov $2, %rax
+    push %rax
+   .loc 1 42
+   .loc 1 42
+   .loc 1 42
+   .loc 1 42
+    lea -225(%rbp), %rax
+    push %rax
+   .loc 1 42
+    mov $1, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 42
+   .loc 1 42
+   .loc 1 42
+    lea -224(%rbp), %rax
+    push %rax
+   .loc 1 42
+    mov $2, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 42
+   .loc 1 42
+    lea -224(%rbp), %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 42
+    lea .L..main.30(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 44
+   .loc 1 44
+   .loc 1 44
+    mov $1, %rax
+    push %rax
+   .loc 1 44
+   .loc 1 44
+   .loc 1 44
+   .loc 1 44
+    mov $1, %rax
+    push %rax
+   .loc 1 44
+    lea .L..main.31(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+    mov $10, %rax
+    push %rax
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+   .loc 1 45
+    mov $10, %rax
+    push %rax
+   .loc 1 45
+    lea .L..main.32(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 47
+   .loc 1 47
+   .loc 1 47
+    mov $2, %rax
+    push %rax
+   .loc 1 47
+   .loc 1 47
+   .loc 1 47
+   .loc 1 47
+    lea -212(%rbp), %rax
+    push %rax
+   .loc 1 47
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 47
+   .loc 1 47
+   .loc 1 47
+   .loc 1 47
+    lea -208(%rbp), %rax
+    push %rax
+   .loc 1 47
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 47
+   .loc 1 47
+    lea -212(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 47
+    lea .L..main.33(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+    mov $2, %rax
+    push %rax
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+    lea -204(%rbp), %rax
+    push %rax
+   .loc 1 48
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+    lea -200(%rbp), %rax
+    push %rax
+   .loc 1 48
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 48
+   .loc 1 48
+   .loc 1 48
+    lea -196(%rbp), %rax
+    push %rax
+   .loc 1 48
+    mov $4, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 48
+   .loc 1 48
+    lea -204(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 48
+    lea .L..main.34(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 49
+   .loc 1 49
+   .loc 1 49
+    mov $3, %rax
+    push %rax
+   .loc 1 49
+   .loc 1 49
+   .loc 1 49
+   .loc 1 49
+    lea -192(%rbp), %rax
+    push %rax
+   .loc 1 49
+    mov $2, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 49
+   .loc 1 49
+   .loc 1 49
+    lea -192(%rbp), %rax
+    push %rax
+   .loc 1 49
+    mov $3, %rax
+    pop %rdi
+   mov %eax, (%rdi)
+   .loc 1 49
+   .loc 1 49
+    lea -192(%rbp), %rax
+   movsxd (%rax), %rax
+    push %rax
+   .loc 1 49
+    lea .L..main.35(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+    mov $7, %rax
+    push %rax
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+    lea -176(%rbp), %rax
+    push %rax
+   .loc 1 53
+   .loc 1 53
+    lea -184(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+    lea -168(%rbp), %rax
+    push %rax
+   .loc 1 53
+   .loc 1 53
+    lea -177(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 53
+   .loc 1 53
+   .loc 1 53
+    lea -176(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 53
+    lea -168(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    sub %rdi, %rax
+    push %rax
+   .loc 1 53
+    lea .L..main.36(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 56
+   .loc 1 56
+   .loc 1 56
+    mov $1, %rax
+    push %rax
+   .loc 1 56
+   .loc 1 56
+   .loc 1 56
+   .loc 1 56
+   .loc 1 56
+   .loc 1 56
+   .loc 1 56
+    lea -144(%rbp), %rax
+    push %rax
+   .loc 1 56
+   .loc 1 56
+    lea -149(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 56
+   .loc 1 56
+   .loc 1 56
+    lea -136(%rbp), %rax
+    push %rax
+   .loc 1 56
+   .loc 1 56
+    lea -148(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 56
+   .loc 1 56
+   .loc 1 56
+    lea -144(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 56
+    lea -136(%rbp), %rax
+    mov (%rax), %rax
+    pop %rdi
+    sub %rdi, %rax
+    push %rax
+   .loc 1 56
+    lea .L..main.37(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 58
+   .loc 1 58
+   .loc 1 58
+    mov $8, %rax
+    push %rax
+   .loc 1 58
+   .loc 1 58
+   .loc 1 58
+   .loc 1 58
+    mov $8, %rax
+    push %rax
+   .loc 1 58
+    lea .L..main.38(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 60
+   .loc 1 60
+   .loc 1 60
+    mov $2, %rax
+    push %rax
+   .loc 1 60
+   .loc 1 60
+   .loc 1 60
+   .loc 1 60
+    mov $2, %rax
+    push %rax
+   .loc 1 60
+    lea .L..main.39(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 62
+   .loc 1 62
+   .loc 1 62
+    mov $24, %rax
+    push %rax
+   .loc 1 62
+   .loc 1 62
+   .loc 1 62
+   .loc 1 62
+    mov $24, %rax
+    push %rax
+   .loc 1 62
+    lea .L..main.40(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 63
+   .loc 1 63
+   .loc 1 63
+    mov $8, %rax
+    push %rax
+   .loc 1 63
+   .loc 1 63
+   .loc 1 63
+   .loc 1 63
+    mov $8, %rax
+    push %rax
+   .loc 1 63
+    lea .L..main.41(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 64
+   .loc 1 64
+   .loc 1 64
+    mov $1, %rax
+    push %rax
+   .loc 1 64
+   .loc 1 64
+   .loc 1 64
+   .loc 1 64
+    mov $1, %rax
+    push %rax
+   .loc 1 64
+    lea .L..main.42(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 65
+   .loc 1 65
+   .loc 1 65
+    mov $3, %rax
+    push %rax
+   .loc 1 65
+   .loc 1 65
+   .loc 1 65
+   .loc 1 65
+    mov $3, %rax
+    push %rax
+   .loc 1 65
+    lea .L..main.43(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 66
+   .loc 1 66
+   .loc 1 66
+    mov $12, %rax
+    push %rax
+   .loc 1 66
+   .loc 1 66
+   .loc 1 66
+   .loc 1 66
+    mov $12, %rax
+    push %rax
+   .loc 1 66
+    lea .L..main.44(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 67
+   .loc 1 67
+   .loc 1 67
+    mov $4, %rax
+    push %rax
+   .loc 1 67
+   .loc 1 67
+   .loc 1 67
+   .loc 1 67
+    mov $4, %rax
+    push %rax
+   .loc 1 67
+    lea .L..main.45(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 68
+   .loc 1 68
+   .loc 1 68
+    mov $3, %rax
+    push %rax
+   .loc 1 68
+   .loc 1 68
+   .loc 1 68
+   .loc 1 68
+   .loc 1 68
+   .loc 1 68
+   .loc 1 68
+    lea -48(%rbp), %rax
+    push %rax
+   .loc 1 68
+   .loc 1 68
+    lea -20(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 68
+   .loc 1 68
+    lea -20(%rbp), %rax
+    push %rax
+   .loc 1 68
+    mov $3, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 68
+   .loc 1 68
+   .loc 1 68
+   .loc 1 68
+   .loc 1 68
+    lea -48(%rbp), %rax
+    mov (%rax), %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 68
+    lea .L..main.46(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+    mov $4, %rax
+    push %rax
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+    lea -16(%rbp), %rax
+    push %rax
+   .loc 1 69
+   .loc 1 69
+    lea -19(%rbp), %rax
+    pop %rdi
+   mov %rax, (%rdi)
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+    lea -16(%rbp), %rax
+    mov (%rax), %rax
+    push %rax
+   .loc 1 69
+    mov $4, %rax
+    pop %rdi
+    mov %al, (%rdi)
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+   .loc 1 69
+    lea -16(%rbp), %rax
+    mov (%rax), %rax
+    movsbl (%rax), %eax
+    push %rax
+   .loc 1 69
+    lea .L..main.47(%rip), %rax
+    push %rax
+    pop %rdx
+    pop %rsi
+    pop %rdi
+    mov $0, %rax
+    call assert
+   .loc 1 71
+   .loc 1 71
+   .loc 1 73
+   .loc 1 73
+   .loc 1 73
+    lea .L..main.48(%rip), %rax
+    push %rax
+    pop %rdi
+    mov $0, %rax
+    call printf
+   .loc 1 74
+   .loc 1 74
+    mov $0, %rax
+    jmp .L.return.main
+.L.return.main:
+    mov %rbp, %rsp
+    pop %rbp
+    ret
@@ -1,91 +1,339 @@
 #include "au_cc.h"
 
-// input filename
-static char* current_filename;
+// source files
+// every file is assigned a range of a single offset space, in loading order,
+// so that a token locates its file, line and column from its offset alone
+typedef struct SourceFile SourceFile;
+struct SourceFile
+{
+    char* name;
+    int file_no;    // 1-based, used by .file and .loc
+    int base;       // offset of the first byte of the file
+    int size;       // bytes of contents, unless streamed
+    char* contents; // contents[0] is the byte at offset `offset`
+    int offset;     // base unless the streaming lexer has released a prefix
+
+    // offsets of the first character of every line, recorded by the lexer
+    // in increasing order, so that the line of any location can be found
+    // with a binary search instead of rescanning the file
+    int* line_starts;
+    int num_lines;
+    int line_capacity;
+
+    dev_t dev; // identity of an included file
+    ino_t ino;
+    Token* tokens; // tokens of an included file, lexed on first use
+
+    // how contents are released with the file
+    size_t mapped_size; // size of the mapping made by map_file(), if mapped
+    bool owns_contents; // allocated by the lexer
+};
+
+// a streamed main file can not be sized in advance; files included by it
+// are placed after this many bytes of offset space
+#define STREAM_SIZE_LIMIT (1 << 30)
+
+// the state of the lexer of a compiler (see Compiler)
+// large inputs are lexed in chunks on several threads, each of which runs
+// a lexer of its own (see tokenize_parallel())
+struct Lexer
+{
+    SourceFile** files;
+    int num_files;
+    int next_base; // base of the next file loaded
+
+    // the file and line found by the last lookup; tokens are mostly located
+    // in order (ex: by the .loc directives of codegen), so the next lookup
+    // is usually on the same line or a few lines after it
+    SourceFile* hint_file;
+    int hint_line;
+
+    // file being lexed
+    SourceFile* current_file;
+
+    // input string; current_input[0] is the byte at offset input_offset
+    // the offset is the file base unless the streaming or the parallel lexer
+    // works on a part of the file
+    char* current_input;
+    int input_offset;
+
+    // whether the next token starts a line or follows whitespace (see TF_BOL)
+    bool at_bol;
+    bool has_space;
 
-// input string
-static char* current_input;
+    // set if the input continues past the terminating '\0' of current_input, so that
+    // a block comment running into it is not an error; lex() then stops at the
+    // comment and sets stopped_in_comment
+    bool more_input;
+    bool stopped_in_comment;
+    int comment_offset; // where that comment starts
+    int comment_lines;  // num_lines when it started
+
+    // a speculative lexer run unwinds to lex_fail instead of reporting errors
+    bool speculative;
+    jmp_buf lex_fail;
+
+    // identifiers are interned into lex_names if set, or the compiler's table
+    InternTable* lex_names;
+
+    // the token stream: a contiguous array that is grown while lexing,
+    // plus a side table for the payload of number and string literals
+    Token* tokens;
+    int num_tokens;
+    int token_capacity;
+
+    Literal* literals;
+    int num_literals;
+    int literal_capacity;
+
+    // token arrays owned by no file (those of a streamed input and of
+    // fragments) handed to the parser, which references them until the unit
+    // ends
+    Token** kept;
+    int num_kept;
+    int kept_capacity;
+
+    // source of the tokens created by the preprocessor
+    SourceFile fragment_file;
+
+    // incremental lexing of stdin and pipes
+    // the source is read in chunks into current_input, which only holds the
+    // bytes from the start of the declaration being lexed onward
+    FILE* stream;
+    bool stream_eof;
+    int window_len;      // bytes of source in current_input
+    int window_capacity; // allocated size of current_input
+    int lex_pos;         // where the next declaration starts in current_input
+};
 
 void error(char* fmt, ...)
 {
     va_list ap;
     va_start(ap, fmt); // initializes ap to arguments after fmt which contains string fomrat specifier % for each ...
-    vfprintf(stderr, fmt, ap);
-    fprintf(stderr, "\n");
-    exit(1);
+    vfprintf(error_output(), fmt, ap);
+    fprintf(error_output(), "\n");
+    error_return();
+}
+
+static SourceFile* new_source_file(char* name, char* contents, int size)
+{
+    Lexer* lx = cc->lexer;
+    if (lx->next_base > INT_MAX - size - 1)
+        error("%s: too much input", name);
+
+    SourceFile* file = calloc(1, sizeof(SourceFile));
+    file->name = strdup(name);
+    file->file_no = lx->num_files + 1;
+    file->base = lx->next_base;
+    file->size = size;
+    file->contents = contents;
+    file->offset = lx->next_base;
+    lx->next_base += size + 1;
+
+    lx->files = realloc(lx->files, sizeof(SourceFile*) * (lx->num_files + 1));
+    lx->files[lx->num_files++] = file;
+    return file;
+}
+
+// starts a new compilation with name as its main file
+static SourceFile* new_main_file(char* name, char* contents, int size)
+{
+    reset_lexer();
+    return new_source_file(name, contents, size);
+}
+
+// returns the file whose offset range contains offset
+static SourceFile* find_file(int offset)
+{
+    Lexer* lx = cc->lexer;
+    SourceFile* file = lx->hint_file;
+    if (file && file->base <= offset && (file->file_no == lx->num_files || offset < lx->files[file->file_no]->base))
+        return file;
+
+    int lo = 0;
+    int hi = lx->num_files - 1;
+    while (lo < hi)
+    {
+        int mid = (lo + hi + 1) / 2;
+        if (lx->files[mid]->base <= offset)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    lx->hint_file = lx->files[lo];
+    lx->hint_line = 0;
+    return lx->hint_file;
+}
+
+int num_source_files(void)
+{
+    return cc->lexer->num_files;
+}
+
+char* source_file_name(int file_no)
+{
+    return cc->lexer->files[file_no - 1]->name;
+}
+
+// hashes the contents of an included file, as the lexer read them
+Hash source_file_hash(int file_no)
+{
+    SourceFile* file = cc->lexer->files[file_no - 1];
+    return hash_bytes(HASH_INIT, file->contents, file->size);
+}
+
+static void add_line_start(char* p)
+{
+    Lexer* lx = cc->lexer;
+    SourceFile* file = lx->current_file;
+    if (file->num_lines == file->line_capacity)
+    {
+        file->line_capacity = file->line_capacity ? file->line_capacity * 2 : 1024;
+        file->line_starts = realloc(file->line_starts, sizeof(int) * file->line_capacity);
+    }
+    file->line_starts[file->num_lines++] = p - lx->current_input + lx->input_offset;
+}
+
+// returns the 0-based index of the line of file containing offset
+static int find_line(SourceFile* file, int offset)
+{
+    Lexer* lx = cc->lexer;
+    int i = lx->hint_line;
+    if (file == lx->hint_file && i < file->num_lines && file->line_starts[i] <= offset)
+    {
+        for (int n = 0; n < 4 && i < file->num_lines; ++n, ++i)
+            if (i + 1 == file->num_lines || offset < file->line_starts[i + 1])
+                return lx->hint_line = i;
+    }
+
+    int lo = 0;
+    int hi = file->num_lines - 1;
+
+    // find the last line starting at or before offset
+    while (lo < hi)
+    {
+        int mid = (lo + hi + 1) / 2;
+        if (file->line_starts[mid] <= offset)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    if (file == lx->hint_file)
+        lx->hint_line = lo;
+    return lo;
+}
+
+int line_number(Token* tok)
+{
+    return find_line(find_file(tok->offset), tok->offset) + 1;
+}
+
+int file_number(Token* tok)
+{
+    return find_file(tok->offset)->file_no;
 }
 
 // reports an error message in the following format
 // ex:
-//  foo.c:10: x = y + 1;
-//                ^ <error message>
-
-static void verror_at(int line_num, char* loc, char* fmt, va_list ap)
+//  foo.c:10:5: x = y + 1;
+//                  ^ <error message>
+// the source line is omitted if the streaming lexer has already released it
+static void verror_at(int offset, char* fmt, va_list ap)
 {
-    // find a beginning of the loc
-    char* line = loc;
-    while (current_input < line && line[-1] != '\n')
-        line--;
+    FILE* out = error_output();
+    SourceFile* file = find_file(offset);
+    int idx = find_line(file, offset);
+    int line_start = file->line_starts[idx];
+    int col = offset - line_start + 1;
 
-    char* end = loc;
-    while (*end != '\n')
-        ++end;
+    // print out the line: foo.c:10:5:
+    int indent = fprintf(out, "%s:%d:%d: ", file->name, idx + 1, col);
+
+    if (line_start < file->offset)
+    {
+        vfprintf(out, fmt, ap);
+        fprintf(out, "\n");
+        return;
+    }
 
-    // print out the line: foo.c:10:
-    int indent = fprintf(stderr, "%s:%d: ", current_filename, line_num);
+    char* line = file->contents + (line_start - file->offset);
+    char* end = file->contents + (offset - file->offset);
+    while (*end && *end != '\n')
+        ++end;
 
     // x = y + 1;
-    fprintf(stderr, "%.*s\n", (int)(end - line), line); // * passes width specifier; . speficies that truncation is possible
+    fprintf(out, "%.*s\n", (int)(end - line), line); // * passes width specifier; . speficies that truncation is possible
 
     // show the error message
-    int pos = loc - line + indent;
+    int pos = col - 1 + indent;
 
-    fprintf(stderr, "%*s", pos, ""); // print pos amount of space
-    fprintf(stderr, "^ ");
-    vfprintf(stderr, fmt, ap);
-    fprintf(stderr, "\n");
+    fprintf(out, "%*s", pos, ""); // print pos amount of space
+    fprintf(out, "^ ");
+    vfprintf(out, fmt, ap);
+    fprintf(out, "\n");
 }
 
 void error_at(char* loc, char* fmt, ...)
 {
-    int line_num = 1;
-    for (char* p = current_input; p < loc; ++p)
-        if (*p == '\n')
-            ++line_num;
+    Lexer* lx = cc->lexer;
+    if (lx->speculative)
+        longjmp(lx->lex_fail, 1);
 
     va_list ap;
     va_start(ap, fmt);
-    verror_at(line_num, loc, fmt, ap);
-    exit(1);
+    verror_at(loc - lx->current_input + lx->input_offset, fmt, ap);
+    error_return();
 }
 
 void error_tok(Token* tok, char* fmt, ...)
 {
     va_list ap;
     va_start(ap, fmt);
-    verror_at(tok->line_num, tok->loc, fmt, ap);
-    exit(1);
+    verror_at(tok->offset, fmt, ap);
+    error_return();
+}
+
+// spelling of multi-character punctuators and keywords, indexed by id - PU_EQ
+static char* id_str[] = {
+    "==", "!=", "<=", ">=", "->",
+    "void", "return", "if", "else", "for", "while", "short", "int", "long",
+    "sizeof", "char", "struct", "union", "typedef", "static", "inline",
+};
+
+// spelling of single-character punctuators, indexed by the character; a
+// constant table since compilers on several threads share it
+#define SINGLE1(c) { (c), '\0' }
+#define SINGLE4(c) SINGLE1(c), SINGLE1((c) + 1), SINGLE1((c) + 2), SINGLE1((c) + 3)
+#define SINGLE16(c) SINGLE4(c), SINGLE4((c) + 4), SINGLE4((c) + 8), SINGLE4((c) + 12)
+#define SINGLE64(c) SINGLE16(c), SINGLE16((c) + 16), SINGLE16((c) + 32), SINGLE16((c) + 48)
+static const char single_str[256][2] = { SINGLE64(0), SINGLE64(64), SINGLE64(128), SINGLE64(192) };
+
+char* token_id_str(int id)
+{
+    if (id >= PU_EQ)
+        return id_str[id - PU_EQ];
+    return (char*)single_str[id];
 }
 
-bool equal(Token* tok, char* op)
+bool equal(Token* tok, int id)
 {
-    return memcmp(tok->loc, op, tok->len) == 0 && op[tok->len] == '\0'; // memcmp: compares the first tok->len bytes
+    return tok->id == id;
 }
 
-Token* skip(Token* tok, char* s)
+Token* skip(Token* tok, int id)
 {
-    if (!equal(tok, s))
+    if (!equal(tok, id))
     {
-        error_tok(tok, "expected '%s'", s);
+        error_tok(tok, "expected '%s'", token_id_str(id));
     }
-    return tok->next;
+    return tok + 1;
 }
 
-bool consume(Token** rest, Token* tok, char* str)
+bool consume(Token** rest, Token* tok, int id)
 {
-    if (equal(tok, str))
+    if (equal(tok, id))
     {
-        *rest = tok->next;
+        *rest = tok + 1;
         return true;
     }
 
@@ -93,41 +341,65 @@ bool consume(Token** rest, Token* tok, char* str)
     return false;
 }
 
-static int get_number(Token* tok)
+// returns NULL if the streaming lexer has released the source of tok
+char* token_loc(Token* tok)
 {
-    if (tok->kind != TK_NUM)
-        error_tok(tok, "expected a number");
-    return tok->val;
+    SourceFile* file = find_file(tok->offset);
+    if (tok->offset < file->offset)
+        return NULL;
+    return file->contents + (tok->offset - file->offset);
 }
 
-Token* new_token(TokenKind kind, char* start, char* end)
+Literal* get_literal(Token* tok)
 {
-    Token* tok = calloc(1, sizeof(Token));
+    return &cc->lexer->literals[tok->literal];
+}
+
+// appends a token to the stream; the returned pointer stays valid until the next call
+static Token* new_token(TokenKind kind, char* start, char* end)
+{
+    Lexer* lx = cc->lexer;
+    if (lx->num_tokens == lx->token_capacity)
+    {
+        lx->token_capacity = lx->token_capacity ? lx->token_capacity * 2 : 4096;
+        lx->tokens = realloc(lx->tokens, sizeof(Token) * lx->token_capacity);
+    }
+
+    Token* tok = &lx->tokens[lx->num_tokens++];
+    *tok = (Token) {};
     tok->kind = kind;
-    tok->loc = start;
+    tok->flags = (lx->at_bol ? TF_BOL : 0) | (lx->has_space ? TF_SPACE : 0);
+    tok->offset = start - lx->current_input + lx->input_offset;
     tok->len = end - start;
+    lx->at_bol = lx->has_space = false;
     return tok;
 }
 
+static Literal* new_literal(Token* tok)
+{
+    Lexer* lx = cc->lexer;
+    if (lx->num_literals == lx->literal_capacity)
+    {
+        lx->literal_capacity = lx->literal_capacity ? lx->literal_capacity * 2 : 256;
+        lx->literals = realloc(lx->literals, sizeof(Literal) * lx->literal_capacity);
+    }
+
+    tok->literal = lx->num_literals;
+    Literal* lit = &lx->literals[lx->num_literals++];
+    *lit = (Literal) {};
+    return lit;
+}
+
 // bool is_operator(char *op)
 // {
 //     return *op == '<' || *op == '>' || *op == '+' || *op == '-' || *op == '/' || *op == '*' || *op == '(' || *op == ')';
 // }
 
-static bool start_with(char* p, char* q)
-{
-    return strncmp(p, q, strlen(q)) == 0;
-}
-
 static bool is_ident_letter(char c)
 {
     return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z') || c == '_';
 }
 
-static bool is_ident_nonletter(char c)
-{
-    return is_ident_letter(c) || ('0' <= c && c <= '9');
-}
 
 // parse A-F 1-9 a-f
 static int parse_hex(char c)
@@ -140,41 +412,79 @@ static int parse_hex(char c)
         return c - 'a' + 10;
     return c - 'A' + 10;
 }
-static int read_op(char* p)
+// two-character punctuators, perfectly hashed by their first character
+static struct
 {
-    static char* keyword[] = { "==", "!=", "<=", ">=", "->" };
+    char second;
+    int id;
+} punct2[128] = {
+    ['='] = { '=', PU_EQ },
+    ['!'] = { '=', PU_NE },
+    ['<'] = { '=', PU_LE },
+    ['>'] = { '=', PU_GE },
+    ['-'] = { '>', PU_ARROW },
+};
+
+// ASCII punctuation characters; a table avoids the locale lookup of ispunct()
+static bool is_punct[128] = {
+    ['!'] = 1, ['"'] = 1, ['#'] = 1, ['$'] = 1, ['%'] = 1, ['&'] = 1, ['\''] = 1, ['('] = 1,
+    [')'] = 1, ['*'] = 1, ['+'] = 1, [','] = 1, ['-'] = 1, ['.'] = 1, ['/'] = 1, [':'] = 1,
+    [';'] = 1, ['<'] = 1, ['='] = 1, ['>'] = 1, ['?'] = 1, ['@'] = 1, ['['] = 1, ['\\'] = 1,
+    [']'] = 1, ['^'] = 1, ['_'] = 1, ['`'] = 1, ['{'] = 1, ['|'] = 1, ['}'] = 1, ['~'] = 1,
+};
 
-    for (int i = 0; i < sizeof(keyword) / sizeof(*keyword); ++i)
+// returns the length of the punctuator at p and stores its ID in *id
+static int read_punct(char* p, int* id)
+{
+    unsigned char c = *p;
+    if (c < 128 && punct2[c].id && p[1] == punct2[c].second)
+    {
+        *id = punct2[c].id;
+        return 2;
+    }
+    if (c < 128 && is_punct[c])
     {
-        if (start_with(p, keyword[i]))
-            return strlen(keyword[i]);
+        *id = c;
+        return 1;
     }
-    return ispunct(*p) ? 1 : 0;
+    return 0;
 }
 
-static bool is_keyword(Token* tok)
-{
-    static char* kw[] = {
-        "void",
-        "return",
-        "if",
-        "else",
-        "for",
-        "while",
-        "short",
-        "int",
-        "long",
-        "sizeof",
-        "char",
-        "struct",
-        "union" };
+// perfect hash of the keyword set: (length + 6 * last character) mod 32 is
+// distinct for every keyword, so a lookup costs one hash and one memcmp
+// the slots below were computed offline; adding a keyword requires picking
+// a free slot (or new constants) so that the hash stays collision free
+#define KW_HASH(p, len) (((len) + 6 * (unsigned char)(p)[(len) - 1]) & 31)
 
-    for (int i = 0; i < sizeof(kw) / sizeof(*kw); ++i)
-    {
-        if (equal(tok, kw[i]))
-            return true;
-    }
-    return false;
+static unsigned char kw_table[32] = {
+    [28] = KW_VOID - PU_EQ,
+    [26] = KW_RETURN - PU_EQ,
+    [6] = KW_IF - PU_EQ,
+    [2] = KW_ELSE - PU_EQ,
+    [15] = KW_FOR - PU_EQ,
+    [3] = KW_WHILE - PU_EQ,
+    [29] = KW_SHORT - PU_EQ,
+    [27] = KW_INT - PU_EQ,
+    [14] = KW_LONG - PU_EQ,
+    [10] = KW_SIZEOF - PU_EQ,
+    [16] = KW_CHAR - PU_EQ,
+    [30] = KW_STRUCT - PU_EQ,
+    [25] = KW_UNION - PU_EQ,
+    [11] = KW_TYPEDEF - PU_EQ,
+    [24] = KW_STATIC - PU_EQ,
+    [4] = KW_INLINE - PU_EQ,
+};
+
+// returns the keyword ID of the identifier [p, p + len) or TI_NONE
+static int keyword_id(char* p, int len)
+{
+    int idx = kw_table[KW_HASH(p, len)];
+    if (!idx)
+        return TI_NONE;
+    char* kw = id_str[idx];
+    if (strncmp(p, kw, len) == 0 && kw[len] == '\0')
+        return PU_EQ + idx;
+    return TI_NONE;
 }
 
 static int read_escaped_ch(char** new_pos, char* p)
@@ -245,14 +555,17 @@ static int read_escaped_ch(char** new_pos, char* p)
 static char* string_literal_end(char* p)
 {
     char* start = p;
-    for (; *p != '"'; ++p)
+    for (;; ++p)
     {
+        p = scan.find_any(p, '"', '\\', '\n');
+        if (*p == '"')
+            return p;
         if (*p == '\n' || *p == '\0')
             error_at(start, "unclosed string literal");
-        if (*p == '\\')
-            ++p;
+        // skip the escaped character
+        if (*++p == '\0')
+            error_at(start, "unclosed string literal");
     }
-    return p;
 }
 
 static Token* read_string_literal(char* start)
@@ -267,119 +580,775 @@ static Token* read_string_literal(char* start)
         if (*p == '\\')
         {
             buf[len++] = read_escaped_ch(&p, p + 1);
+            continue;
         }
-        else
-        {
-            buf[len++] = *p++;
-        }
+
+        // copy the run of plain characters up to the next escape at once
+        char* q = scan.find_any(p, '\\', '"', '"');
+        memcpy(buf + len, p, q - p);
+        len += q - p;
+        p = q;
     }
 
     Token* tok = new_token(TK_STR, start, end + 1); // store "..."
-    tok->ty = array_of(ty_char, len + 1);
-    tok->str = buf;
+    Literal* lit = new_literal(tok);
+    lit->len = len + 1;
+    lit->str = buf;
     return tok;
 }
 
-static void convert_keywords(Token* tok)
+// tracks where a top-level declaration ends so that the streaming lexer can
+// hand the parser one declaration at a time: the declaration ends at a ';'
+// outside any brackets or at the '}' closing a function body
+typedef struct
+{
+    int depth;     // nesting of (), [] and {}
+    bool is_body;  // the outermost '{' follows a ')'
+    int last_id;   // ID of the previous token
+    bool done;     // a declaration has been completed
+    bool in_directive; // on a preprocessing directive line
+} Segment;
+
+static void update_segment(Segment* seg, Token* tok)
 {
-    for (Token* t = tok; t->kind != TK_EOF; t = t->next)
+    switch (tok->id)
     {
-        if (is_keyword(t))
-            t->kind = TK_KEYWORD;
+    case '(':
+    case '[':
+        ++seg->depth;
+        break;
+    case '{':
+        if (seg->depth++ == 0)
+            seg->is_body = seg->last_id == ')';
+        break;
+    case ')':
+    case ']':
+        --seg->depth;
+        break;
+    case '}':
+        if (--seg->depth == 0 && seg->is_body)
+            seg->done = true;
+        break;
+    case ';':
+        if (seg->depth == 0)
+            seg->done = true;
+        break;
     }
+    seg->last_id = tok->id;
 }
 
-// initialize line number into all the tokens
-// -> finds a line number by parsing the entire current input from the beginning
-static void add_line_numbers(Token* tok)
+// skips the rest of a block comment, recording the line starts within it
+// returns the position after "*/" or NULL if the input ends first
+static char* finish_block_comment(char* p)
 {
-    char* p = current_input;
-    int num = 1;
-
-    do
+    for (;; ++p)
     {
-        if (p == tok->loc)
-        {
-            tok->line_num = num;
-            tok = tok->next;
-        }
+        p = scan.find_any(p, '*', '\n', '\n');
+        if (*p == '\0')
+            return NULL;
         if (*p == '\n')
-            ++num;
-    } while (*p++);
+            add_line_start(p + 1);
+        else if (p[1] == '/')
+            return p + 2;
+    }
 }
 
-static Token* tokenize(char* filename, char* p)
+// single pass over the input: comments, line starts, keywords and
+// punctuator IDs are all resolved as each token is produced
+// lexes until the terminating '\0' or, if seg is given, until a top-level
+// declaration is complete; returns where lexing stopped
+static char* lex(char* p, Segment* seg)
 {
-    current_filename = filename;
-    current_input = p;
-    Token head = {};
-    Token* cur = &head;
-
+    Lexer* lx = cc->lexer;
+    lx->stopped_in_comment = false;
     while (*p)
     {
-        // skip line comments
-        if (start_with(p, "//"))
+        if (*p == '\n')
+        {
+            add_line_start(++p);
+            lx->at_bol = true;
+            lx->has_space = false;
+            continue;
+        }
+
+        if (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\v' || *p == '\f')
+        {
+            p = scan.skip_blank(p + 1);
+            lx->has_space = true;
+            continue;
+        }
+
+        // skip line comments; the terminating '\n' is recorded above
+        if (p[0] == '/' && p[1] == '/')
         {
-            p += 2;
-            while (*p != '\n')
-                ++p;
+            p = scan.find_any(p + 2, '\n', '\n', '\n');
+            lx->has_space = true;
             continue;
         }
 
         // skip block comments
-        if (start_with(p, "/*"))
+        if (p[0] == '/' && p[1] == '*')
         {
-            char* end = strstr(p + 2, "*/");
-            if (!end)
-                error_at(p, "unclosed block comment");
-            p = end + 2;
+            char* start = p;
+            int lines = lx->current_file->num_lines;
+            p = finish_block_comment(p + 2);
+            if (!p)
+            {
+                // the comment may continue in input that is not in current_input
+                if (!lx->more_input)
+                    error_at(start, "unclosed block comment");
+                lx->stopped_in_comment = true;
+                lx->comment_offset = start - lx->current_input + lx->input_offset;
+                lx->comment_lines = lines;
+                return start;
+            }
+            lx->has_space = true;
             continue;
         }
 
-        int op_len = read_op(p);
-        if (isspace(*p))
-            ++p;
-        else if (isdigit(*p))
+        Token* tok;
+        int id;
+        int punct_len;
+        if ('0' <= *p && *p <= '9')
         {
-            cur = cur->next = new_token(TK_NUM, p, p);
-            char* q = p;
-            cur->val = strtoul(p, &p, 10);
-            cur->len = p - q;
+            // decimal digits are accumulated directly (numbers are too short to vectorize)
+            char* start = p;
+            uint64_t val = 0;
+            for (; '0' <= *p && *p <= '9'; ++p)
+            {
+                int digit = *p - '0';
+                if (val > (UINT64_MAX - digit) / 10)
+                    error_at(start, "integer literal is too large");
+                val = val * 10 + digit;
+            }
+            tok = new_token(TK_NUM, start, p);
+            new_literal(tok)->val = val;
         }
         else if (*p == '"')
         {
-            cur = cur->next = read_string_literal(p);
-            p += cur->len;
+            tok = read_string_literal(p);
+            p += tok->len;
         }
         // identifier | keyword
         else if (is_ident_letter(*p))
         {
             char* start = p;
-            do
-            {
-                ++p;
-            } while (is_ident_nonletter(*p));
-            cur = cur->next = new_token(TK_IDENT, start, p);
+            p = scan.ident_end(p + 1);
+            tok = new_token(TK_IDENT, start, p);
+            tok->id = keyword_id(start, p - start);
+            if (tok->id)
+                tok->kind = TK_KEYWORD;
+            else
+                tok->sym = lx->lex_names ? intern_in(lx->lex_names, start, p - start) : intern(start, p - start);
         }
-        else if (op_len)
+        else if ((punct_len = read_punct(p, &id)))
         {
-            cur = cur->next = new_token(TK_OPERATOR, p, p + op_len);
-            p += cur->len;
+            tok = new_token(TK_OPERATOR, p, p + punct_len);
+            tok->id = id;
+            p += punct_len;
         }
         else
         {
             error_at(p, "invalid token");
         }
+
+        if (seg)
+        {
+            // directives are not part of declarations
+            if (tok->flags & TF_BOL)
+                seg->in_directive = tok->id == '#';
+            if (seg->in_directive)
+                continue;
+            update_segment(seg, tok);
+            if (seg->done)
+                return p;
+        }
+    }
+    return p;
+}
+
+// lexes a whole file into a new token array
+static Token* lex_file(SourceFile* file)
+{
+    Lexer* lx = cc->lexer;
+    lx->current_file = file;
+    lx->current_input = file->contents;
+    lx->input_offset = file->base;
+    lx->more_input = false;
+    lx->at_bol = true;
+    lx->has_space = false;
+    lx->tokens = NULL;
+    lx->num_tokens = 0;
+    lx->token_capacity = 0;
+    add_line_start(lx->current_input);
+
+    char* p = lex(lx->current_input, NULL);
+    new_token(TK_EOF, p, p);
+
+    // the file is never lexed again, so release the unused capacity
+    lx->tokens = realloc(lx->tokens, sizeof(Token) * lx->num_tokens);
+    lx->token_capacity = lx->num_tokens;
+    file->tokens = lx->tokens;
+    return lx->tokens;
+}
+
+// p[size] must be '\0'
+Token* tokenize_buffer(char* filename, char* p, size_t size)
+{
+    Lexer* lx = cc->lexer;
+    init_scan_kernels();
+    lx->stream = NULL;
+    lx->num_literals = 0;
+    return lex_file(new_main_file(filename, p, size));
+}
+
+Token* tokenize(char* filename, char* p)
+{
+    return tokenize_buffer(filename, p, strlen(p));
+}
+
+// lexer state of the main file, saved while an included file or a
+// fragment created by the preprocessor is lexed
+typedef struct
+{
+    SourceFile* file;
+    char* input;
+    int offset;
+    bool more_input;
+    bool at_bol;
+    bool has_space;
+    Token* tokens;
+    int num_tokens;
+    int token_capacity;
+} LexState;
+
+static LexState save_lex_state(void)
+{
+    Lexer* lx = cc->lexer;
+    return (LexState) { lx->current_file, lx->current_input, lx->input_offset, lx->more_input, lx->at_bol, lx->has_space, lx->tokens, lx->num_tokens, lx->token_capacity };
+}
+
+static void restore_lex_state(LexState* st)
+{
+    Lexer* lx = cc->lexer;
+    lx->current_file = st->file;
+    lx->current_input = st->input;
+    lx->input_offset = st->offset;
+    lx->more_input = st->more_input;
+    lx->at_bol = st->at_bol;
+    lx->has_space = st->has_space;
+    lx->tokens = st->tokens;
+    lx->num_tokens = st->num_tokens;
+    lx->token_capacity = st->token_capacity;
+}
+
+// returns the tokens of a file loaded by load_source_file()
+// every file is lexed once however often it is included
+Token* file_tokens(int file_no)
+{
+    SourceFile* file = cc->lexer->files[file_no - 1];
+    if (file->tokens)
+        return file->tokens;
+    if (!file->contents || file->offset != file->base)
+        error("%s: a streamed input cannot be included", file->name);
+
+    LexState st = save_lex_state();
+    lex_file(file);
+    restore_lex_state(&st);
+    return file->tokens;
+}
+
+// releases tokens with the unit
+static Token* keep_tokens(Token* tokens)
+{
+    Lexer* lx = cc->lexer;
+    if (lx->num_kept == lx->kept_capacity)
+    {
+        lx->kept_capacity = lx->kept_capacity ? lx->kept_capacity * 2 : 64;
+        lx->kept = realloc(lx->kept, sizeof(Token*) * lx->kept_capacity);
     }
-    cur = cur->next = new_token(TK_EOF, p, p);
-    add_line_numbers(head.next);
-    convert_keywords(head.next);
-    return head.next;
+    lx->kept[lx->num_kept++] = tokens;
+    return tokens;
 }
 
-// return the contents of the given file
-static char* read_file(char* path)
+// lexes text created by the preprocessor (ex: a stringized macro argument)
+// every token is located at origin; returns NULL if text is not valid
+Token* tokenize_fragment(char* text, Token* origin)
 {
+    Lexer* lx = cc->lexer;
+    LexState st = save_lex_state();
+    lx->current_file = &lx->fragment_file;
+    lx->current_input = text;
+    lx->input_offset = origin->offset;
+    lx->more_input = false;
+    lx->at_bol = lx->has_space = false;
+    lx->tokens = NULL;
+    lx->num_tokens = 0;
+    lx->token_capacity = 0;
+
+    Token* result = NULL;
+    lx->speculative = true;
+    if (!setjmp(lx->lex_fail))
+    {
+        char* p = lex(text, NULL);
+        new_token(TK_EOF, p, p);
+        for (int i = 0; i < lx->num_tokens; ++i)
+            lx->tokens[i].offset = origin->offset;
+        result = keep_tokens(realloc(lx->tokens, sizeof(Token) * lx->num_tokens));
+    }
+    else
+        free(lx->tokens);
+    lx->speculative = false;
+
+    restore_lex_state(&st);
+    return result;
+}
+
+// writes the spelling of a token, as needed to stringize or paste it
+void print_token_text(FILE* out, Token* tok)
+{
+    switch (tok->kind)
+    {
+    case TK_IDENT:
+        fputs(symbol_name(tok->sym), out);
+        break;
+    case TK_KEYWORD:
+    case TK_OPERATOR:
+        fputs(token_id_str(tok->id), out);
+        break;
+    case TK_NUM:
+        fprintf(out, "%ld", get_literal(tok)->val);
+        break;
+    case TK_STR:
+    {
+        Literal* lit = get_literal(tok);
+        fputc('"', out);
+        for (int i = 0; i < lit->len - 1; ++i)
+        {
+            unsigned char c = lit->str[i];
+            if (c == '"' || c == '\\')
+                fprintf(out, "\\%c", c);
+            else if (c < ' ' || c >= 127)
+                fprintf(out, "\\%03o", c);
+            else
+                fputc(c, out);
+        }
+        fputc('"', out);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
+// reads the next chunk of the stream into the window
+// uses read(2) rather than fread() so that whatever the upstream process
+// has written so far is lexed without waiting for a full buffer
+static void read_chunk(void)
+{
+    Lexer* lx = cc->lexer;
+    enum { CHUNK = 64 * 1024 };
+
+    if (lx->window_capacity - lx->window_len < CHUNK + 1)
+    {
+        lx->window_capacity = lx->window_capacity * 2 > lx->window_len + CHUNK + 1 ? lx->window_capacity * 2 : lx->window_len + CHUNK + 1;
+        lx->current_input = realloc(lx->current_input, lx->window_capacity);
+    }
+
+    ssize_t n;
+    do
+        n = read(fileno(lx->stream), lx->current_input + lx->window_len, CHUNK);
+    while (n < 0 && errno == EINTR);
+
+    if (n < 0)
+        error("cannot read %s: %s", lx->current_file->name, strerror(errno));
+    if (n == 0)
+        lx->stream_eof = true;
+    lx->window_len += n;
+    lx->current_input[lx->window_len] = '\0';
+    if (lx->input_offset + lx->window_len >= STREAM_SIZE_LIMIT)
+        error("%s: too much input", lx->current_file->name);
+    lx->current_file->contents = lx->current_input;
+}
+
+// returns the tokens of the next top-level declaration of a streamed input,
+// terminated by TK_EOF; returns a lone TK_EOF once the input is exhausted
+// for an input lexed as a whole, that is the TK_EOF ending the token array
+Token* tokenize_more(void)
+{
+    Lexer* lx = cc->lexer;
+    if (!lx->stream)
+        return &lx->tokens[lx->num_tokens - 1];
+
+    // the parser is done with the previous declaration; release its source
+    memmove(lx->current_input, lx->current_input + lx->lex_pos, lx->window_len - lx->lex_pos + 1);
+    lx->input_offset += lx->lex_pos;
+    lx->window_len -= lx->lex_pos;
+    lx->lex_pos = 0;
+    lx->current_file->offset = lx->input_offset;
+
+    // the previous token array is still referenced by the AST
+    lx->tokens = NULL;
+    lx->num_tokens = 0;
+    lx->token_capacity = 0;
+
+    Segment seg = {};
+    for (;;)
+    {
+        // no token spans a newline, so only complete lines are lexed until the
+        // end of the stream; block comments running past them are retried
+        int end = lx->window_len;
+        if (!lx->stream_eof)
+        {
+            while (end > lx->lex_pos && lx->current_input[end - 1] != '\n')
+                --end;
+        }
+
+        if (end > lx->lex_pos)
+        {
+            char saved = lx->current_input[end];
+            lx->current_input[end] = '\0';
+            lx->more_input = !lx->stream_eof;
+            lx->lex_pos = lex(lx->current_input + lx->lex_pos, &seg) - lx->current_input;
+            lx->current_input[end] = saved;
+
+            if (seg.done)
+                break;
+
+            // the comment is lexed again once more input has been read
+            if (lx->stopped_in_comment)
+                lx->current_file->num_lines = lx->comment_lines;
+        }
+
+        if (lx->stream_eof)
+            break;
+        read_chunk();
+    }
+
+    char* p = lx->current_input + lx->lex_pos;
+    new_token(TK_EOF, p, p);
+
+    return keep_tokens(lx->tokens);
+}
+
+// the file and at least one zero byte after it, in whole pages
+static size_t mapping_size(size_t size)
+{
+    size_t page = sysconf(_SC_PAGESIZE);
+    return (size / page + 1) * page;
+}
+
+// maps a regular file into memory so that the lexer reads it without a copy
+// the input must be terminated by '\0': bytes past the end of the file in its
+// last page are zero-filled, and if the file ends exactly on a page boundary
+// the anonymous page reserved behind it provides the terminator
+// returns NULL if fp cannot be mapped (ex: pipes, terminals or empty files)
+static char* map_file(FILE* fp, size_t* size_out)
+{
+    struct stat st;
+    if (fstat(fileno(fp), &st) != 0 || !S_ISREG(st.st_mode) || st.st_size == 0)
+        return NULL;
+
+    size_t size = st.st_size;
+    size_t reserved = mapping_size(size);
+
+    // reserve zero-filled address space, then map the file over its beginning
+    char* buf = mmap(NULL, reserved, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (buf == MAP_FAILED)
+        return NULL;
+
+    if (mmap(buf, size, PROT_READ, MAP_PRIVATE | MAP_FIXED, fileno(fp), 0) == MAP_FAILED)
+    {
+        munmap(buf, reserved);
+        return NULL;
+    }
+    *size_out = size;
+    return buf;
+}
+
+// parallel lexing of large inputs
+// the input is split into chunks at line starts and every chunk is lexed on
+// its own thread into private token, literal, line and identifier tables;
+// the chunks are then appended in order, renumbering their identifiers and
+// literals. no token spans a newline, so a chunk lexes the same as it would in
+// a single pass unless it starts inside a block comment: the chunk before it
+// then stops at that comment, and the comment and the chunk are lexed again
+// serially. a chunk whose speculative run failed is also lexed again, which
+// reports the error just as a serial run would
+
+typedef struct
+{
+    int start, end; // offsets of the chunk in the input
+    char* copy;     // '\0'-terminated copy of the chunk
+
+    bool failed;
+    bool in_comment; // the chunk ends inside a block comment
+    int comment_offset;
+
+    bool at_bol; // state of the lexer at that comment
+    bool has_space;
+
+    Token* tokens;
+    int num_tokens;
+    Literal* literals;
+    int num_literals;
+    SourceFile lines; // line starts of the chunk
+    InternTable* names;
+} Chunk;
+
+// copies [start, end) of p so that the lexer finds a '\0' at its end
+static char* copy_range(char* p, int start, int end)
+{
+    char* copy = malloc(end - start + 1);
+    memcpy(copy, p + start, end - start);
+    copy[end - start] = '\0';
+    return copy;
+}
+
+static void* lex_chunk(void* arg)
+{
+    Chunk* c = arg;
+
+    // the worker thread has no compiler of its own; it runs a lexer whose
+    // tables are appended to the compiler's once the chunk is lexed
+    Lexer lexer = {};
+    Compiler worker = { .lexer = &lexer };
+    cc = &worker;
+
+    lexer.current_file = &c->lines;
+    lexer.current_input = c->copy;
+    lexer.input_offset = c->start;
+    lexer.more_input = true;
+    lexer.at_bol = true;
+    lexer.speculative = true;
+    lexer.lex_names = new_intern_table();
+
+    // the line start at the chunk start is recorded by the chunk before it
+    if (c->start == 0)
+        add_line_start(c->copy);
+
+    if (setjmp(lexer.lex_fail))
+        c->failed = true;
+    else
+    {
+        lex(c->copy, NULL);
+        c->in_comment = lexer.stopped_in_comment;
+        c->comment_offset = lexer.comment_offset;
+        c->at_bol = lexer.at_bol;
+        c->has_space = lexer.has_space;
+        if (lexer.stopped_in_comment)
+            c->lines.num_lines = lexer.comment_lines;
+    }
+
+    c->tokens = lexer.tokens;
+    c->num_tokens = lexer.num_tokens;
+    c->literals = lexer.literals;
+    c->num_literals = lexer.num_literals;
+    c->names = lexer.lex_names;
+    return NULL;
+}
+
+// appends the result of a worker to the tables of the compiler
+static void append_chunk(Chunk* c)
+{
+    Lexer* lx = cc->lexer;
+    int* syms = malloc(sizeof(int) * (intern_table_size(c->names) + 1));
+    for (int i = 0; i < intern_table_size(c->names); ++i)
+    {
+        char* name = intern_table_name(c->names, i);
+        syms[i] = intern(name, strlen(name));
+    }
+
+    if (lx->num_tokens + c->num_tokens > lx->token_capacity)
+    {
+        lx->token_capacity = (lx->num_tokens + c->num_tokens) * 2;
+        lx->tokens = realloc(lx->tokens, sizeof(Token) * lx->token_capacity);
+    }
+    if (lx->num_literals + c->num_literals > lx->literal_capacity)
+    {
+        lx->literal_capacity = (lx->num_literals + c->num_literals) * 2;
+        lx->literals = realloc(lx->literals, sizeof(Literal) * lx->literal_capacity);
+    }
+    SourceFile* file = lx->current_file;
+    if (file->num_lines + c->lines.num_lines > file->line_capacity)
+    {
+        file->line_capacity = (file->num_lines + c->lines.num_lines) * 2;
+        file->line_starts = realloc(file->line_starts, sizeof(int) * file->line_capacity);
+    }
+
+    for (int i = 0; i < c->num_tokens; ++i)
+    {
+        Token* tok = &lx->tokens[lx->num_tokens + i];
+        *tok = c->tokens[i];
+        if (tok->kind == TK_IDENT)
+            tok->sym = syms[tok->sym];
+        else if (tok->kind == TK_NUM || tok->kind == TK_STR)
+            tok->literal += lx->num_literals;
+    }
+    lx->num_tokens += c->num_tokens;
+
+    memcpy(lx->literals + lx->num_literals, c->literals, sizeof(Literal) * c->num_literals);
+    lx->num_literals += c->num_literals;
+    memcpy(file->line_starts + file->num_lines, c->lines.line_starts, sizeof(int) * c->lines.num_lines);
+    file->num_lines += c->lines.num_lines;
+
+    free(syms);
+}
+
+// lexes [start, end) of p on the calling thread, appending to its tables
+// start is either a chunk start or the start of a comment left open by the
+// previous chunk, and at_bol and has_space are set as of start
+// returns the offset of a block comment left open at end, or -1
+static int relex_range(char* p, int start, int end, bool is_last)
+{
+    Lexer* lx = cc->lexer;
+    char* copy = copy_range(p, start, end);
+
+    lx->current_input = copy;
+    lx->input_offset = start;
+    lx->more_input = !is_last;
+    if (lx->current_file->num_lines == 0)
+        add_line_start(copy); // the first chunk failed
+
+    lex(copy, NULL);
+    int resume = -1;
+    if (lx->stopped_in_comment)
+    {
+        lx->current_file->num_lines = lx->comment_lines;
+        resume = lx->comment_offset;
+    }
+
+    free(copy);
+    lx->current_input = p;
+    lx->input_offset = 0;
+    return resume;
+}
+
+static Token* tokenize_parallel(char* filename, char* p, size_t size, int nthreads)
+{
+    Lexer* lx = cc->lexer;
+    init_scan_kernels();
+    lx->current_file = new_main_file(filename, p, size);
+    lx->current_input = p;
+    lx->input_offset = 0;
+    lx->more_input = false;
+    lx->stream = NULL;
+    lx->tokens = NULL;
+    lx->num_tokens = 0;
+    lx->token_capacity = 0;
+    lx->num_literals = 0;
+
+    // chunk boundaries are moved forward to the next line start
+    Chunk* chunks = calloc(nthreads, sizeof(Chunk));
+    int num_chunks = 0;
+    size_t start = 0;
+    for (int i = 1; i <= nthreads && start < size; ++i)
+    {
+        size_t end = i == nthreads ? size : size / nthreads * i;
+        if (end < start)
+            end = start;
+        while (end < size && (end == 0 || p[end - 1] != '\n'))
+            ++end;
+        if (end == start)
+            continue;
+
+        Chunk* c = &chunks[num_chunks++];
+        c->start = start;
+        c->end = end;
+        c->copy = copy_range(p, start, end);
+        start = end;
+    }
+
+    pthread_t* threads = calloc(num_chunks, sizeof(pthread_t));
+    for (int i = 0; i < num_chunks; ++i)
+        if (pthread_create(&threads[i], NULL, lex_chunk, &chunks[i]) != 0)
+            error("cannot create a lexer thread");
+
+    int resume = -1;
+    for (int i = 0; i < num_chunks; ++i)
+    {
+        Chunk* c = &chunks[i];
+        pthread_join(threads[i], NULL);
+
+        bool is_last = i == num_chunks - 1;
+        if (resume >= 0)
+            resume = relex_range(p, resume, c->end, is_last);
+        else if (c->failed)
+        {
+            lx->at_bol = true;
+            lx->has_space = false;
+            resume = relex_range(p, c->start, c->end, is_last);
+        }
+        else
+        {
+            append_chunk(c);
+            resume = c->in_comment ? c->comment_offset : -1;
+            lx->at_bol = c->at_bol;
+            lx->has_space = c->has_space;
+        }
+
+        free(c->copy);
+        free(c->tokens);
+        free(c->literals);
+        free(c->lines.line_starts);
+        free_intern_table(c->names);
+    }
+    free(threads);
+    free(chunks);
+
+    if (resume >= 0)
+        error_at(p + resume, "unclosed block comment");
+
+    new_token(TK_EOF, p + size, p + size);
+    lx->tokens = realloc(lx->tokens, sizeof(Token) * lx->num_tokens);
+    lx->token_capacity = lx->num_tokens;
+    lx->current_file->tokens = lx->tokens;
+    return lx->tokens;
+}
+
+// inputs smaller than this are not worth starting threads for
+#define PARALLEL_LEX_MIN_SIZE (1 << 20)
+#define PARALLEL_LEX_CHUNK_SIZE (256 * 1024)
+
+static int lex_thread_count(size_t size)
+{
+    if (cc->lex_threads)
+        return cc->lex_threads;
+    if (size < PARALLEL_LEX_MIN_SIZE)
+        return 1;
+
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    long n = size / PARALLEL_LEX_CHUNK_SIZE;
+    return n < cpus ? n : cpus;
+}
+
+// lexes the size bytes at p, which are terminated by '\0', on several
+// threads if they are many
+Token* tokenize_source(char* filename, char* p, size_t size)
+{
+    int nthreads = lex_thread_count(size);
+    return nthreads > 1 ? tokenize_parallel(filename, p, size, nthreads) : tokenize_buffer(filename, p, size);
+}
+
+// opens the file at path for reading; a relative path is relative to the base
+// directory of the compiler, if it has one; messages and .file directives
+// still name the file by path
+static FILE* open_source(char* path)
+{
+    if (!cc->base_dir || path[0] == '/')
+        return fopen(path, "r");
+    char* full = format("%s/%s", cc->base_dir, path);
+    FILE* fp = fopen(full, "r");
+    free(full);
+    return fp;
+}
+
+// regular files are mapped and lexed as a whole; stdin, pipes and anything
+// else that cannot be mapped are lexed incrementally while the parser runs,
+// which overlaps lexing and parsing with the process writing the input
+Token* tokenize_file(char* path)
+{
+    Lexer* lx = cc->lexer;
     FILE* fp;
 
     // by convention, "-" refers to stdin
@@ -389,50 +1358,160 @@ static char* read_file(char* path)
     }
     else
     {
-        fp = fopen(path, "r");
+        fp = open_source(path);
         if (!fp)
         {
             // strerror: searches an internal array for the errno and returns a pointer to the error message
             error("cannot open %s: %s", path, strerror(errno));
         }
+
+        size_t size;
+        char* buf = map_file(fp, &size);
+        if (buf)
+        {
+            struct stat st;
+            fstat(fileno(fp), &st);
+            fclose(fp);
+
+            Token* tok = tokenize_source(path, buf, size);
+            lx->files[0]->dev = st.st_dev;
+            lx->files[0]->ino = st.st_ino;
+            lx->files[0]->mapped_size = mapping_size(size);
+            return tok;
+        }
     }
 
+    init_scan_kernels();
+    lx->current_file = new_main_file(path, NULL, STREAM_SIZE_LIMIT);
+    lx->current_file->owns_contents = true; // the window
+    lx->current_input = NULL;
+    lx->input_offset = 0;
+    lx->at_bol = true;
+    lx->has_space = false;
+    lx->stream = fp;
+    lx->stream_eof = false;
+    lx->window_len = 0;
+    lx->window_capacity = 0;
+    lx->lex_pos = 0;
+    lx->num_literals = 0;
+
+    read_chunk();
+    add_line_start(lx->current_input);
+    return tokenize_more();
+}
+
+// reads the rest of fp into memory, for files that cannot be mapped (ex: an
+// empty file); the buffer is terminated by '\0'
+char* read_file(FILE* fp, size_t* size_out)
+{
     char* buf;
-    size_t buflen;
+    size_t size;
+    FILE* out = open_memstream(&buf, &size);
 
-    // dynamically open a stream for writing to a memory buffer (&buf)
-    // updated upon fflush or fclose
-    FILE* out = open_memstream(&buf, &buflen);
+    char chunk[4096];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), fp)) > 0)
+        fwrite(chunk, 1, n, out);
+    fclose(out); // open_memstream terminates buf with '\0'
 
-    // read the entire file
-    for (;;)
+    *size_out = size;
+    return buf;
+}
+
+// registers the file at path for inclusion and returns its file number,
+// or -1 if it cannot be opened
+// a file is read once: opening it again by another path finds the same file
+int load_source_file(char* path)
+{
+    Lexer* lx = cc->lexer;
+    for (int i = 0; i < lx->num_files; ++i)
+        if (!strcmp(lx->files[i]->name, path))
+            return lx->files[i]->file_no;
+
+    FILE* fp = open_source(path);
+    if (!fp)
+        return -1;
+
+    struct stat st;
+    if (fstat(fileno(fp), &st) == 0)
     {
-        char buf2[4096];
-        // reads data from fp into the array pointed to by buf2
-        int n = fread(buf2, 1, sizeof(buf2), fp);
-        if (n == 0)
-            break;
-        // writes data from buf2 to given stream pointed by out
-        fwrite(buf2, 1, n, out);
+        for (int i = 0; i < lx->num_files; ++i)
+        {
+            if (lx->files[i]->dev == st.st_dev && lx->files[i]->ino == st.st_ino)
+            {
+                fclose(fp);
+                return lx->files[i]->file_no;
+            }
+        }
     }
 
-    if (fp != stdin)
-        fclose(fp);
+    size_t size;
+    char* buf = map_file(fp, &size);
+    bool is_mapped = buf;
+    if (!buf)
+        buf = read_file(fp, &size);
+    fclose(fp);
 
-    // explicitly flushing the buffer to the stream
-    fflush(out);
+    SourceFile* file = new_source_file(path, buf, size);
+    file->dev = st.st_dev;
+    file->ino = st.st_ino;
+    file->mapped_size = is_mapped ? mapping_size(size) : 0;
+    file->owns_contents = !is_mapped;
+    return file->file_no;
+}
 
-    // make sure that the last line is properly terminated with '\n'
-    if (buflen == 0 || buf[buflen - 1] != '\n')
-        fputc('\n', out);
-    // writes a character to the specified stream and advances the position indicator of the stream
-    fputc('\0', out);
-    fclose(out);
-    return buf;
+Lexer* new_lexer(void)
+{
+    return calloc(1, sizeof(Lexer));
 }
 
-Token* tokenize_file(char* path)
+static void free_source_file(SourceFile* file)
+{
+    if (file->mapped_size)
+        munmap(file->contents, file->mapped_size);
+    else if (file->owns_contents)
+        free(file->contents);
+    free(file->name);
+    free(file->line_starts);
+    free(file->tokens);
+    free(file);
+}
+
+// ends the translation unit: its files, tokens and literals are released
+void reset_lexer(void)
+{
+    Lexer* lx = cc->lexer;
+    for (int i = 0; i < lx->num_files; ++i)
+        free_source_file(lx->files[i]);
+    lx->num_files = 0;
+    lx->next_base = 0;
+    lx->hint_file = NULL;
+    lx->current_file = NULL;
+    lx->current_input = NULL;
+
+    for (int i = 0; i < lx->num_kept; ++i)
+        free(lx->kept[i]);
+    lx->num_kept = 0;
+    lx->tokens = NULL;
+    lx->num_tokens = 0;
+    lx->token_capacity = 0;
+
+    for (int i = 0; i < lx->num_literals; ++i)
+        free(lx->literals[i].str);
+    lx->num_literals = 0;
+
+    free(lx->fragment_file.line_starts);
+    lx->fragment_file = (SourceFile) {};
+
+    if (lx->stream && lx->stream != stdin)
+        fclose(lx->stream);
+    lx->stream = NULL;
+}
+
+void free_lexer(Lexer* lx)
 {
-    char* p = read_file(path);
-    return tokenize(path, p);
+    free(lx->files);
+    free(lx->kept);
+    free(lx->literals);
+    free(lx);
 }
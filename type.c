@@ -1,14 +1,31 @@
 #include "au_cc.h"
 
-Type* ty_void = &(Type) { TY_VOID, 1, 1 };
-Type* ty_int = &(Type) { TY_INT, 4, 4 }; // initialize the first member of Type (typekind) to TY_INT
-Type* ty_char = &(Type) { TY_CHAR, 1, 1 };
-Type* ty_short = &(Type) { TY_SHORT, 2, 2 };
-Type* ty_long = &(Type) { TY_LONG, 8, 8 };
+// the builtin types are per thread since declarator() writes to them (see
+// Type.name); an array of one type is used as a pointer to it
+_Thread_local Type ty_void[1] = { { TY_VOID, 1, 1 } };
+_Thread_local Type ty_int[1] = { { TY_INT, 4, 4 } }; // initialize the first member of Type (typekind) to TY_INT
+_Thread_local Type ty_char[1] = { { TY_CHAR, 1, 1 } };
+_Thread_local Type ty_short[1] = { { TY_SHORT, 2, 2 } };
+_Thread_local Type ty_long[1] = { { TY_LONG, 8, 8 } };
+
+// the types of a compiler (see Compiler)
+struct TypeTable
+{
+    // types of the translation unit, released by reset_types()
+    Region region;
+
+    // derived types are hash-consed: structurally identical pointer and array
+    // types are a single object, so deriving a type again (ex: &x for every
+    // address-of) allocates nothing and equal types compare equal by pointer
+    // function types are not, since each one carries its own parameter list
+    Type** derived_types; // open addressing, NULL if the slot is empty
+    int derived_capacity;  // power of 2
+    int num_derived;
+};
 
 static Type* new_type(TypeKind kind, int size, int align)
 {
-    Type* ty = calloc(1, sizeof(Type)); // calloc(num_of_element_allocated, size_of_each_element) all initialized to zero
+    Type* ty = region_alloc(&cc->types->region, sizeof(Type)); // region memory is all initialized to zero
     ty->kind = kind;
     ty->size = size;
     ty->align = align;
@@ -23,32 +40,107 @@ bool is_integer(Type* ty)
 
 Type* copy_type(Type* ty)
 {
-    Type* ret = calloc(1, sizeof(Type));
+    Type* ret = region_alloc(&cc->types->region, sizeof(Type));
     *ret = *ty;
     return ret;
 }
 
-Type* pointer_to(Type* base)
+static uint32_t hash_derived(TypeKind kind, Type* base, int len)
+{
+    uint64_t h = (uintptr_t)base * 0x9E3779B97F4A7C15ull;
+    h ^= ((uint64_t)len << 4 | kind) * 0xC2B2AE3D27D4EB4Full;
+    return h >> 32;
+}
+
+static void grow_derived_types(void)
+{
+    TypeTable* tt = cc->types;
+    Type** old = tt->derived_types;
+    int old_capacity = tt->derived_capacity;
+
+    tt->derived_capacity = tt->derived_capacity ? tt->derived_capacity * 2 : 1024;
+    tt->derived_types = calloc(tt->derived_capacity, sizeof(Type*));
+    for (int i = 0; i < old_capacity; ++i)
+    {
+        Type* ty = old[i];
+        if (!ty)
+            continue;
+        int j = hash_derived(ty->kind, ty->base, ty->array_len) & (tt->derived_capacity - 1);
+        while (tt->derived_types[j])
+            j = (j + 1) & (tt->derived_capacity - 1);
+        tt->derived_types[j] = ty;
+    }
+    free(old);
+}
+
+// returns the canonical pointer to base (TY_PTR) or array of len base (TY_ARRAY)
+static Type* derived_type(TypeKind kind, Type* base, int len)
 {
-    Type* ty = new_type(TY_PTR, 8, 8);
+    TypeTable* tt = cc->types;
+
+    // keep the load factor below 1/2
+    if (tt->num_derived * 2 >= tt->derived_capacity)
+        grow_derived_types();
+
+    int i = hash_derived(kind, base, len) & (tt->derived_capacity - 1);
+    for (; tt->derived_types[i]; i = (i + 1) & (tt->derived_capacity - 1))
+    {
+        Type* ty = tt->derived_types[i];
+        if (ty->kind == kind && ty->base == base && ty->array_len == len)
+            return ty;
+    }
+
+    Type* ty = kind == TY_PTR ? new_type(TY_PTR, 8, 8) : new_type(TY_ARRAY, base->size * len, base->align);
     ty->base = base;
+    ty->array_len = len;
+    tt->derived_types[i] = ty;
+    ++tt->num_derived;
     return ty;
 }
 
+TypeTable* new_type_table(void)
+{
+    return calloc(1, sizeof(TypeTable));
+}
+
+void free_type_table(TypeTable* tt)
+{
+    region_free(&tt->region);
+    free(tt->derived_types);
+    free(tt);
+}
+
+// releases every type created since the last reset; the builtin types stay
+void reset_types(void)
+{
+    TypeTable* tt = cc->types;
+    region_reset(&tt->region);
+    if (tt->derived_types)
+        memset(tt->derived_types, 0, sizeof(Type*) * tt->derived_capacity);
+    tt->num_derived = 0;
+}
+
+Type* pointer_to(Type* base)
+{
+    return derived_type(TY_PTR, base, 0);
+}
+
 Type* func_type(Type* return_ty)
 {
-    Type* ty = calloc(1, sizeof(Type));
-    ty->kind = TY_FUNC;
+    Type* ty = new_type(TY_FUNC, 0, 0);
     ty->return_ty = return_ty;
     return ty;
 }
 
+// members, size and alignment are filled in by the parser
+Type* struct_type(void)
+{
+    return new_type(TY_STRUCT, 0, 1);
+}
+
 Type* array_of(Type* base, int len)
 {
-    Type* ty = new_type(TY_ARRAY, base->size * len, base->align);
-    ty->base = base;
-    ty->array_len = len;
-    return ty;
+    return derived_type(TY_ARRAY, base, len);
 }
 
 static Type* get_common_type(Type* ty1, Type* ty2) {
@@ -66,29 +158,20 @@ static Type* get_common_type(Type* ty1, Type* ty2) {
 
 static void usual_arith_conv(Node** lhs, Node** rhs) {
     Type* ty = get_common_type((*lhs)->ty, (*rhs)->ty);
-    *lhs = new_cast(*lhs, ty);
-    *rhs = new_cast(*rhs, ty);
+    // types are canonical, so an operand of the common type needs no cast
+    if ((*lhs)->ty != ty)
+        *lhs = new_cast(*lhs, ty);
+    if ((*rhs)->ty != ty)
+        *rhs = new_cast(*rhs, ty);
 }
 
+// nodes are typed as they are built, so the operands of node already have
+// their types and only the node itself needs one; statements get none
 void add_type(Node* node)
 {
     if (!node || node->ty)
         return;
 
-    add_type(node->lhs);
-    add_type(node->rhs);
-    add_type(node->cond);
-    add_type(node->then);
-    add_type(node->els);
-    add_type(node->init);
-    add_type(node->inc);
-
-    for (Node* n = node->body; n; n = n->next)
-        add_type(n);
-
-    for (Node* n = node->args; n; n = n->next)
-        add_type(n);
-
     switch (node->kind)
     {
     case ND_NUM: